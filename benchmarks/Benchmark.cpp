@@ -0,0 +1,20 @@
+#include "Benchmark.hpp"
+
+std::vector<BenchmarkInfo>& getBenchmarks() {
+    static std::vector<BenchmarkInfo> benchmarks;
+    return benchmarks;
+}
+
+BenchmarkRegistration::BenchmarkRegistration(const char* name,
+                                             BenchmarkFunction function) {
+    getBenchmarks().push_back({name, function, 0});
+}
+
+BenchmarkRegistration::BenchmarkRegistration(
+    const char* name, BenchmarkFunction function,
+    std::initializer_list<int64_t> args) {
+    for (auto arg : args) {
+        getBenchmarks().push_back(
+            {std::string(name) + "/" + std::to_string(arg), function, arg});
+    }
+}
@@ -0,0 +1,142 @@
+#ifndef _RWBENCHMARKS_BENCHMARK_HPP_
+#define _RWBENCHMARKS_BENCHMARK_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Handed to each benchmark to drive its timed loop
+ *
+ * Setup is done first, then the measured work is repeated while
+ * keepRunning() returns true. Only the loop is timed:
+ *
+ *     RW_BENCHMARK(Example) {
+ *         auto fixture = createFixture();
+ *         while (state.keepRunning()) {
+ *             doNotOptimize(work(fixture));
+ *         }
+ *     }
+ */
+class BenchmarkRun {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    BenchmarkRun(uint64_t iterations, int64_t arg)
+        : iterations(iterations), arg(arg) {
+    }
+
+    bool keepRunning() {
+        if (count == 0) {
+            start = Clock::now();
+        }
+        if (count < iterations) {
+            ++count;
+            return true;
+        }
+        end = Clock::now();
+        return false;
+    }
+
+    /**
+     * @brief getArg Returns the argument this run was registered with
+     */
+    int64_t getArg() const {
+        return arg;
+    }
+
+    /**
+     * @brief setItemsProcessed Sets the number of items handled by each
+     * iteration, used to report a rate
+     */
+    void setItemsProcessed(uint64_t items) {
+        itemsPerIteration = items;
+    }
+
+    /**
+     * @brief skip Marks the benchmark as not runnable, it reports the reason
+     * instead of a time
+     */
+    void skip(const std::string& reason) {
+        skipReason = reason;
+    }
+
+    uint64_t getIterations() const {
+        return iterations;
+    }
+
+    uint64_t getItemsProcessed() const {
+        return itemsPerIteration;
+    }
+
+    const std::string& getSkipReason() const {
+        return skipReason;
+    }
+
+    double getElapsedSeconds() const {
+        return std::chrono::duration<double>(end - start).count();
+    }
+
+private:
+    uint64_t iterations;
+    uint64_t count = 0;
+    int64_t arg;
+    uint64_t itemsPerIteration = 0;
+    std::string skipReason;
+    Clock::time_point start{};
+    Clock::time_point end{};
+};
+
+using BenchmarkFunction = void (*)(BenchmarkRun&);
+
+struct BenchmarkInfo {
+    std::string name;
+    BenchmarkFunction function;
+    int64_t arg;
+};
+
+/**
+ * @brief getBenchmarks Returns every benchmark registered with RW_BENCHMARK
+ * or RW_BENCHMARK_ARGS
+ */
+std::vector<BenchmarkInfo>& getBenchmarks();
+
+struct BenchmarkRegistration {
+    BenchmarkRegistration(const char* name, BenchmarkFunction function);
+
+    /**
+     * Registers the function once for each argument, named "name/arg"
+     */
+    BenchmarkRegistration(const char* name, BenchmarkFunction function,
+                          std::initializer_list<int64_t> args);
+};
+
+/**
+ * @brief doNotOptimize Stops the compiler from discarding a value whose
+ * computation is being measured
+ */
+template <class T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "m"(value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+#define RW_BENCHMARK(name)                                                  \
+    static void benchmark_##name(BenchmarkRun& state);                      \
+    static const BenchmarkRegistration registration_##name(                 \
+        #name, benchmark_##name);                                           \
+    static void benchmark_##name(BenchmarkRun& state)
+
+#define RW_BENCHMARK_ARGS(name, ...)                                        \
+    static void benchmark_##name(BenchmarkRun& state);                      \
+    static const BenchmarkRegistration registration_##name(                 \
+        #name, benchmark_##name, {__VA_ARGS__});                            \
+    static void benchmark_##name(BenchmarkRun& state)
+
+#endif
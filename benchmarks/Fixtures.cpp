@@ -0,0 +1,420 @@
+#include "Fixtures.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <data/Clump.hpp>
+#include <loaders/LoaderIFP.hpp>
+#include <loaders/LoaderIMG.hpp>
+
+namespace {
+constexpr uint32_t kChunkStruct = 0x0001;
+constexpr uint32_t kChunkString = 0x0002;
+constexpr uint32_t kChunkExtension = 0x0003;
+constexpr uint32_t kChunkTexture = 0x0006;
+constexpr uint32_t kChunkMaterial = 0x0007;
+constexpr uint32_t kChunkMaterialList = 0x0008;
+constexpr uint32_t kChunkFrameList = 0x000E;
+constexpr uint32_t kChunkGeometry = 0x000F;
+constexpr uint32_t kChunkClump = 0x0010;
+constexpr uint32_t kChunkAtomic = 0x0014;
+constexpr uint32_t kChunkGeometryList = 0x001A;
+constexpr uint32_t kChunkBinMeshPLG = 0x050E;
+constexpr uint32_t kChunkNodeName = 0x0253F2FE;
+
+/// RenderWare 3.3, as used by GTA III
+constexpr uint32_t kChunkVersion = 0x0C02FFFF;
+
+/// Positions, texture coordinates, prelighting, normals and material colours
+constexpr uint16_t kGeometryFlags = 0x02 | 0x04 | 0x08 | 0x10 | 0x40;
+
+constexpr float kGridSpacing = 0.5f;
+
+/**
+ * Writes nested RenderWare binary stream chunks
+ *
+ * RWBStream reads the header of the chunk following the last one in a
+ * stream, so every container is closed with an empty extension like in the
+ * game's files.
+ */
+class ChunkWriter {
+public:
+    explicit ChunkWriter(std::vector<char>& out) : out(out) {
+    }
+
+    void begin(uint32_t id) {
+        write(id);
+        open.push_back(out.size());
+        write(uint32_t{0});
+        write(kChunkVersion);
+    }
+
+    void end() {
+        const auto sizeOffset = open.back();
+        open.pop_back();
+        const auto size = static_cast<uint32_t>(
+            out.size() - sizeOffset - 2 * sizeof(uint32_t));
+        std::memcpy(out.data() + sizeOffset, &size, sizeof(size));
+    }
+
+    /**
+     * Closes a container chunk, after adding the empty extension
+     */
+    void endContainer() {
+        begin(kChunkExtension);
+        end();
+        end();
+    }
+
+    template <class T>
+    void write(const T& value) {
+        const auto offset = out.size();
+        out.resize(offset + sizeof(T));
+        std::memcpy(out.data() + offset, &value, sizeof(T));
+    }
+
+    /**
+     * Writes a string chunk, null terminated and padded to 4 bytes
+     */
+    void writeString(const std::string& str) {
+        begin(kChunkString);
+        out.insert(out.end(), str.begin(), str.end());
+        out.resize(out.size() + 4 - str.size() % 4, '\0');
+        end();
+    }
+
+private:
+    std::vector<char>& out;
+    std::vector<size_t> open;
+};
+
+void writeFrame(ChunkWriter& writer, const glm::vec3& position,
+                int32_t parent) {
+    const float rotation[9] = {1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f};
+    for (float f : rotation) {
+        writer.write(f);
+    }
+    writer.write(position.x);
+    writer.write(position.y);
+    writer.write(position.z);
+    writer.write(parent);
+    writer.write(uint32_t{0});
+}
+
+void writeGeometry(ChunkWriter& writer, unsigned int gridSize) {
+    const auto side = gridSize + 1;
+    const auto numVerts = side * side;
+    const auto numTris = gridSize * gridSize * 2;
+    const auto extent = gridSize * kGridSpacing;
+
+    writer.begin(kChunkGeometry);
+
+    writer.begin(kChunkStruct);
+    writer.write(kGeometryFlags);
+    writer.write(uint8_t{1});
+    writer.write(uint8_t{0});
+    writer.write(uint32_t{numTris});
+    writer.write(uint32_t{numVerts});
+    writer.write(uint32_t{1});
+    // Ambient, diffuse and specular surface properties
+    writer.write(1.f);
+    writer.write(1.f);
+    writer.write(1.f);
+
+    for (auto v = 0u; v < numVerts; ++v) {
+        writer.write(uint32_t{0xFFC0C0C0});
+    }
+    for (auto y = 0u; y < side; ++y) {
+        for (auto x = 0u; x < side; ++x) {
+            writer.write(static_cast<float>(x) / gridSize);
+            writer.write(static_cast<float>(y) / gridSize);
+        }
+    }
+    std::vector<uint32_t> indices;
+    indices.reserve(numTris * 3);
+    for (auto y = 0u; y < gridSize; ++y) {
+        for (auto x = 0u; x < gridSize; ++x) {
+            const auto i = y * side + x;
+            const uint32_t quad[6] = {i, i + 1, i + side,
+                                      i + 1, i + side + 1, i + side};
+            for (auto t = 0u; t < 2; ++t) {
+                writer.write(static_cast<uint16_t>(quad[t * 3]));
+                writer.write(static_cast<uint16_t>(quad[t * 3 + 1]));
+                writer.write(uint16_t{0});
+                writer.write(static_cast<uint16_t>(quad[t * 3 + 2]));
+            }
+            indices.insert(indices.end(), quad, quad + 6);
+        }
+    }
+    // Bounding sphere
+    writer.write(extent / 2.f);
+    writer.write(extent / 2.f);
+    writer.write(0.f);
+    writer.write(extent * std::sqrt(2.f) / 2.f);
+    writer.write(uint32_t{1});
+    writer.write(uint32_t{1});
+    for (auto y = 0u; y < side; ++y) {
+        for (auto x = 0u; x < side; ++x) {
+            writer.write(x * kGridSpacing);
+            writer.write(y * kGridSpacing);
+            writer.write(0.f);
+        }
+    }
+    for (auto v = 0u; v < numVerts; ++v) {
+        writer.write(0.f);
+        writer.write(0.f);
+        writer.write(1.f);
+    }
+    writer.end();
+
+    writer.begin(kChunkMaterialList);
+    writer.begin(kChunkStruct);
+    writer.write(uint32_t{1});
+    writer.write(int32_t{-1});
+    writer.end();
+    writer.begin(kChunkMaterial);
+    writer.begin(kChunkStruct);
+    writer.write(uint32_t{0});
+    writer.write(uint32_t{0xFFFFFFFF});
+    writer.write(uint32_t{0});
+    writer.write(uint32_t{1});
+    writer.write(1.f);
+    writer.write(1.f);
+    writer.write(1.f);
+    writer.end();
+    writer.begin(kChunkTexture);
+    writer.begin(kChunkStruct);
+    writer.write(uint32_t{0x1106});
+    writer.end();
+    writer.writeString("benchmark");
+    writer.writeString("");
+    writer.endContainer();
+    writer.endContainer();
+    writer.endContainer();
+
+    writer.begin(kChunkExtension);
+    writer.begin(kChunkBinMeshPLG);
+    writer.write(uint32_t{0});
+    writer.write(uint32_t{1});
+    writer.write(static_cast<uint32_t>(indices.size()));
+    writer.write(static_cast<uint32_t>(indices.size()));
+    writer.write(uint32_t{0});
+    for (auto i : indices) {
+        writer.write(i);
+    }
+    writer.end();
+    writer.endContainer();
+
+    writer.endContainer();
+}
+
+void writeFile(const rwfs::path& path, const char* data, size_t size) {
+    std::ofstream out(path.string(), std::ios::binary);
+    out.write(data, static_cast<std::streamsize>(size));
+    if (!out) {
+        throw std::runtime_error("Failed to write " + path.string());
+    }
+}
+
+struct Bone {
+    const char* name;
+    int parent;
+    glm::vec3 offset;
+};
+
+/// Frames of a pedestrian model, the first is the clump root
+const Bone kSkeleton[] = {
+    {"ped", -1, {0.f, 0.f, 0.f}},
+    {"swaist", 0, {0.f, 0.f, 1.f}},
+    {"smid", 1, {0.f, 0.f, 0.2f}},
+    {"shead", 2, {0.f, 0.f, 0.5f}},
+    {"supperarml", 2, {0.f, 0.2f, 0.4f}},
+    {"slowerarml", 4, {0.f, 0.f, -0.3f}},
+    {"slhand", 5, {0.f, 0.f, -0.25f}},
+    {"supperarmr", 2, {0.f, -0.2f, 0.4f}},
+    {"slowerarmr", 7, {0.f, 0.f, -0.3f}},
+    {"srhand", 8, {0.f, 0.f, -0.25f}},
+    {"supperlegl", 1, {0.f, 0.1f, -0.1f}},
+    {"slowerlegl", 10, {0.f, 0.f, -0.45f}},
+    {"sfootl", 11, {0.f, 0.f, -0.45f}},
+    {"supperlegr", 1, {0.f, -0.1f, -0.1f}},
+    {"slowerlegr", 13, {0.f, 0.f, -0.45f}},
+    {"sfootr", 14, {0.f, 0.f, -0.45f}},
+};
+}  // namespace
+
+rwfs::path getFixturePath() {
+    static const rwfs::path path = [] {
+        auto p = rwfs::temp_directory_path() / "rwbenchmarks";
+        rwfs::create_directories(p);
+        return p;
+    }();
+    return path;
+}
+
+std::vector<char> createDFF(unsigned int geometries, unsigned int gridSize) {
+    std::vector<char> data;
+    ChunkWriter writer(data);
+
+    writer.begin(kChunkClump);
+
+    writer.begin(kChunkStruct);
+    writer.write(uint32_t{geometries});
+    writer.end();
+
+    writer.begin(kChunkFrameList);
+    writer.begin(kChunkStruct);
+    writer.write(uint32_t{geometries + 1});
+    writeFrame(writer, glm::vec3(0.f), -1);
+    for (auto g = 0u; g < geometries; ++g) {
+        writeFrame(writer, glm::vec3(0.f, 0.f, g * 0.1f), 0);
+    }
+    writer.end();
+    for (auto f = 0u; f <= geometries; ++f) {
+        const auto name = f == 0 ? std::string("root")
+                                 : "part" + std::to_string(f - 1);
+        writer.begin(kChunkExtension);
+        writer.begin(kChunkNodeName);
+        for (char c : name) {
+            writer.write(c);
+        }
+        writer.end();
+        writer.endContainer();
+    }
+    writer.endContainer();
+
+    writer.begin(kChunkGeometryList);
+    writer.begin(kChunkStruct);
+    writer.write(uint32_t{geometries});
+    writer.end();
+    for (auto g = 0u; g < geometries; ++g) {
+        writeGeometry(writer, gridSize);
+    }
+    writer.endContainer();
+
+    for (auto g = 0u; g < geometries; ++g) {
+        writer.begin(kChunkAtomic);
+        writer.begin(kChunkStruct);
+        writer.write(uint32_t{g + 1});
+        writer.write(uint32_t{g});
+        writer.write(uint32_t{Atomic::ATOMIC_RENDER | 1});
+        writer.write(uint32_t{0});
+        writer.end();
+        writer.endContainer();
+    }
+
+    writer.endContainer();
+    return data;
+}
+
+rwfs::path writeFixture(const std::string& name,
+                        const std::vector<char>& data) {
+    const auto path = getFixturePath() / name;
+    writeFile(path, data.data(), data.size());
+    return path;
+}
+
+std::string getIMGAssetName(size_t n) {
+    return "model" + std::to_string(n) + ".dff";
+}
+
+rwfs::path createIMG(size_t count) {
+    std::vector<char> dir(count * sizeof(LoaderIMGFile));
+    for (size_t i = 0; i < count; ++i) {
+        LoaderIMGFile entry{};
+        entry.offset = static_cast<uint32_t>(i);
+        entry.size = 1;
+        const auto name = getIMGAssetName(i);
+        std::strncpy(entry.name, name.c_str(), sizeof(entry.name) - 1);
+        std::memcpy(dir.data() + i * sizeof(entry), &entry, sizeof(entry));
+    }
+    const auto name = "archive" + std::to_string(count);
+    writeFixture(name + ".dir", dir);
+
+    // Only the size of the archive matters, leave it sparse
+    const auto imgPath = getFixturePath() / (name + ".img");
+    std::ofstream img(imgPath.string(), std::ios::binary);
+    img.seekp(static_cast<std::streamoff>(count * 2048 - 1));
+    img.put('\0');
+    if (!img) {
+        throw std::runtime_error("Failed to write " + imgPath.string());
+    }
+    return imgPath;
+}
+
+ClumpPtr createSkeleton() {
+    std::vector<ModelFramePtr> frames;
+    for (const auto& bone : kSkeleton) {
+        auto frame = std::make_shared<ModelFrame>(
+            static_cast<unsigned int>(frames.size()), glm::mat3(1.f),
+            bone.offset);
+        frame->setName(bone.name);
+        if (bone.parent >= 0) {
+            frames[static_cast<size_t>(bone.parent)]->addChild(frame);
+        }
+        frames.push_back(frame);
+    }
+
+    auto clump = std::make_shared<Clump>();
+    clump->setFrame(frames.front());
+    return clump;
+}
+
+AnimationPtr createWalkAnimation(unsigned int keyframes) {
+    constexpr float kDuration = 1.f;
+
+    auto animation = std::make_shared<Animation>();
+    animation->name = "walk_player";
+    animation->duration = kDuration;
+
+    // Every bone but the root is animated, the waist also moves
+    for (size_t b = 1; b < std::size(kSkeleton); ++b) {
+        const auto& bone = kSkeleton[b];
+        const auto type = b == 1 ? AnimationBone::RT0 : AnimationBone::R00;
+
+        std::vector<AnimationKeyframe> frames;
+        frames.reserve(keyframes);
+        for (auto k = 0u; k < keyframes; ++k) {
+            const float time = kDuration * k / (keyframes - 1);
+            const float swing =
+                std::sin(time * glm::two_pi<float>() + b) * 0.5f;
+            frames.emplace_back(
+                glm::angleAxis(swing, glm::vec3(0.f, 1.f, 0.f)),
+                glm::vec3(0.f, 0.f, std::abs(swing) * 0.1f), glm::vec3(1.f),
+                time, static_cast<int>(k));
+        }
+
+        animation->bones.emplace(
+            bone.name, std::make_unique<AnimationBone>(bone.name, 0, 0,
+                                                       kDuration, type, frames));
+    }
+
+    return animation;
+}
+
+WorldFixture::WorldFixture() : data(&log, getFixturePath() / "data") {
+    // The world's sound manager needs a sound effect archive
+    const auto audioPath = getFixturePath() / "data" / "audio";
+    rwfs::create_directories(audioPath);
+    const char sdtEntry[20] = {};
+    writeFile(audioPath / "sfx.SDT", sdtEntry, sizeof(sdtEntry));
+    writeFile(audioPath / "sfx.RAW", sdtEntry, 0);
+    data.index.indexTree(getFixturePath() / "data");
+
+    world = std::make_unique<GameWorld>(&log, &data, &jobs);
+    state.world = world.get();
+    world->state = &state;
+}
+
+WorldFixture& getWorldFixture() {
+    static WorldFixture fixture;
+    return fixture;
+}
@@ -0,0 +1,90 @@
+#ifndef _RWBENCHMARKS_FIXTURES_HPP_
+#define _RWBENCHMARKS_FIXTURES_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <core/JobSystem.hpp>
+#include <core/Logger.hpp>
+#include <engine/GameData.hpp>
+#include <engine/GameState.hpp>
+#include <engine/GameWorld.hpp>
+#include <rw/filesystem.hpp>
+#include <rw/forward.hpp>
+
+/**
+ * Synthetic data for the benchmarks, so they can run without the game files.
+ * Files are written to a scratch directory under the system temp path.
+ */
+
+/**
+ * @brief getFixturePath Returns the scratch directory, creating it if needed
+ */
+rwfs::path getFixturePath();
+
+/**
+ * @brief createDFF Builds a clump with one atomic per geometry
+ *
+ * Each geometry is a textured, prelit grid of gridSize x gridSize quads
+ * with its own frame under a shared root frame.
+ */
+std::vector<char> createDFF(unsigned int geometries, unsigned int gridSize);
+
+/**
+ * @brief writeFixture Writes data to name in the scratch directory
+ */
+rwfs::path writeFixture(const std::string& name, const std::vector<char>& data);
+
+/**
+ * @brief getIMGAssetName Returns the name of the n'th asset in createIMG
+ */
+std::string getIMGAssetName(size_t n);
+
+/**
+ * @brief createIMG Writes an archive of count one sector assets
+ * @return Path to the .img file
+ */
+rwfs::path createIMG(size_t count);
+
+/**
+ * @brief createSkeleton Builds a clump with a pedestrian's bone hierarchy
+ */
+ClumpPtr createSkeleton();
+
+/**
+ * @brief createWalkAnimation Builds a looping animation that moves every bone
+ * of createSkeleton()
+ */
+AnimationPtr createWalkAnimation(unsigned int keyframes);
+
+/**
+ * @brief A world with no map, which scripts and renderers can run against
+ */
+class WorldFixture {
+public:
+    WorldFixture();
+
+    GameWorld& getWorld() {
+        return *world;
+    }
+
+    GameState& getState() {
+        return state;
+    }
+
+private:
+    Logger log;
+    GameData data;
+    GameState state;
+    JobSystem jobs;
+    std::unique_ptr<GameWorld> world;
+};
+
+/**
+ * @brief getWorldFixture Returns a world shared by every benchmark
+ */
+WorldFixture& getWorldFixture();
+
+#endif
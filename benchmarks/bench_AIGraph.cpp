@@ -0,0 +1,103 @@
+#include "Benchmark.hpp"
+
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <ai/AIGraph.hpp>
+#include <ai/AIGraphNode.hpp>
+#include <data/PathData.hpp>
+
+namespace {
+/// About as many path groups as the game's map places
+constexpr size_t kPaths = 2000;
+constexpr size_t kQueries = 256;
+constexpr float kMapExtent = 1900.f;
+constexpr float kQueryRadius = 200.f;
+
+/**
+ * Builds a graph of short road and pavement segments spread over the map,
+ * each joining the rest of the graph at both ends
+ */
+void createGraph(AIGraph& graph) {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> coordinate(-kMapExtent, kMapExtent);
+
+    for (size_t p = 0; p < kPaths; ++p) {
+        PathData path;
+        path.type = p % 2 == 0 ? PathData::PATH_CAR : PathData::PATH_PED;
+        path.ID = static_cast<uint16_t>(p);
+        for (int n = 0; n < 4; ++n) {
+            PathNode node;
+            node.type = n == 0 || n == 3 ? PathNode::EXTERNAL
+                                         : PathNode::INTERNAL;
+            node.next = n < 3 ? n + 1 : -1;
+            node.position = glm::vec3(n * 8.f, 0.f, 0.f);
+            node.size = 1.f;
+            node.leftLanes = 1;
+            node.rightLanes = 1;
+            path.nodes.push_back(node);
+        }
+        const auto x = coordinate(rng);
+        const auto y = coordinate(rng);
+        graph.createPathNodes(glm::vec3(x, y, 0.f),
+                              glm::quat{1.f, 0.f, 0.f, 0.f}, path);
+    }
+}
+}  // namespace
+
+RW_BENCHMARK(AIGraph_gatherExternalNodesNear) {
+    static const auto graph = [] {
+        auto g = std::make_unique<AIGraph>();
+        createGraph(*g);
+        return g;
+    }();
+
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<float> coordinate(-kMapExtent, kMapExtent);
+    std::vector<glm::vec3> centers;
+    centers.reserve(kQueries);
+    for (size_t i = 0; i < kQueries; ++i) {
+        const auto x = coordinate(rng);
+        const auto y = coordinate(rng);
+        centers.emplace_back(x, y, 0.f);
+    }
+
+    std::vector<AIGraphNode*> nodes;
+    while (state.keepRunning()) {
+        for (const auto& center : centers) {
+            nodes.clear();
+            graph->gatherExternalNodesNear(center, kQueryRadius, nodes,
+                                           AIGraphNode::Vehicle);
+            doNotOptimize(nodes.size());
+        }
+    }
+    state.setItemsProcessed(kQueries);
+}
+
+RW_BENCHMARK(AIGraph_findNearest) {
+    static const auto graph = [] {
+        auto g = std::make_unique<AIGraph>();
+        createGraph(*g);
+        return g;
+    }();
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> coordinate(-kMapExtent, kMapExtent);
+    std::vector<glm::vec3> positions;
+    positions.reserve(kQueries);
+    for (size_t i = 0; i < kQueries; ++i) {
+        const auto x = coordinate(rng);
+        const auto y = coordinate(rng);
+        positions.emplace_back(x, y, 0.f);
+    }
+
+    while (state.keepRunning()) {
+        for (const auto& position : positions) {
+            doNotOptimize(
+                graph->findNearest(AIGraphNode::Pedestrian, position));
+        }
+    }
+    state.setItemsProcessed(kQueries);
+}
@@ -0,0 +1,32 @@
+#include "Benchmark.hpp"
+#include "Fixtures.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <data/Clump.hpp>
+#include <engine/Animator.hpp>
+#include <loaders/LoaderIFP.hpp>
+
+namespace {
+constexpr float kTickTime = 1.f / 60.f;
+}  // namespace
+
+RW_BENCHMARK_ARGS(Animator_tick, 1, 100) {
+    const auto animation = createWalkAnimation(30);
+
+    std::vector<ClumpPtr> skeletons;
+    std::vector<std::unique_ptr<Animator>> animators;
+    for (auto i = 0; i < state.getArg(); ++i) {
+        skeletons.push_back(createSkeleton());
+        animators.push_back(std::make_unique<Animator>(skeletons.back()));
+        animators.back()->playAnimation(0, animation, 1.f, true);
+    }
+
+    while (state.keepRunning()) {
+        for (const auto& animator : animators) {
+            animator->tick(kTickTime);
+        }
+    }
+    state.setItemsProcessed(animators.size());
+}
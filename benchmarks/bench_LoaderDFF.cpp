@@ -0,0 +1,39 @@
+#include "Benchmark.hpp"
+#include "Fixtures.hpp"
+
+#include <data/Clump.hpp>
+#include <loaders/LoaderDFF.hpp>
+#include <platform/FileHandle.hpp>
+#include <platform/MappedFile.hpp>
+
+namespace {
+/**
+ * Parses the same model repeatedly, mapped like an archive asset
+ */
+void loadModel(BenchmarkRun& state, const std::string& name,
+               unsigned int geometries, unsigned int gridSize) {
+    const auto data = createDFF(geometries, gridSize);
+    auto mapping = MappedFile::open(writeFixture(name, data));
+    if (!mapping) {
+        state.skip("Failed to map " + name);
+        return;
+    }
+
+    LoaderDFF loader;
+    while (state.keepRunning()) {
+        auto clump =
+            loader.loadFromMemory(FileContentsInfo(mapping, 0, data.size()));
+        doNotOptimize(clump);
+    }
+}
+}  // namespace
+
+// A street prop, a few hundred triangles
+RW_BENCHMARK(LoaderDFF_loadFromMemory_prop) {
+    loadModel(state, "prop.dff", 1, 12);
+}
+
+// A building with several parts and a few thousand triangles each
+RW_BENCHMARK(LoaderDFF_loadFromMemory_building) {
+    loadModel(state, "building.dff", 6, 40);
+}
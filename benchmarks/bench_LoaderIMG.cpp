@@ -0,0 +1,56 @@
+#include "Benchmark.hpp"
+#include "Fixtures.hpp"
+
+#include <cctype>
+#include <random>
+
+#include <loaders/LoaderIMG.hpp>
+
+namespace {
+/// About as many entries as the game's largest archive
+constexpr size_t kArchiveSize = 6000;
+constexpr size_t kLookups = 1024;
+
+/**
+ * Names in the mixed case used by the data files, with some missing assets
+ */
+std::vector<std::string> createLookupNames() {
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<size_t> index(0, kArchiveSize * 9 / 8);
+
+    std::vector<std::string> names;
+    names.reserve(kLookups);
+    for (size_t i = 0; i < kLookups; ++i) {
+        auto name = getIMGAssetName(index(rng));
+        name[0] = static_cast<char>(std::toupper(name[0]));
+        names.push_back(name);
+    }
+    return names;
+}
+}  // namespace
+
+RW_BENCHMARK(LoaderIMG_load) {
+    const auto path = createIMG(kArchiveSize);
+
+    while (state.keepRunning()) {
+        LoaderIMG archive;
+        doNotOptimize(archive.load(path));
+    }
+    state.setItemsProcessed(kArchiveSize);
+}
+
+RW_BENCHMARK(LoaderIMG_findAssetIndex) {
+    LoaderIMG archive;
+    if (!archive.load(createIMG(kArchiveSize))) {
+        state.skip("Failed to load the archive");
+        return;
+    }
+    const auto names = createLookupNames();
+
+    while (state.keepRunning()) {
+        for (const auto& name : names) {
+            doNotOptimize(archive.findAssetIndex(name));
+        }
+    }
+    state.setItemsProcessed(names.size());
+}
@@ -0,0 +1,79 @@
+#include "Benchmark.hpp"
+#include "Fixtures.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <data/Clump.hpp>
+#include <data/ModelData.hpp>
+#include <loaders/LoaderDFF.hpp>
+#include <objects/InstanceObject.hpp>
+#include <platform/FileHandle.hpp>
+#include <render/ObjectRenderer.hpp>
+#include <render/OpenGLRenderer.hpp>
+#include <render/ViewCamera.hpp>
+
+namespace {
+constexpr size_t kModels = 8;
+constexpr float kMapExtent = 1000.f;
+
+/**
+ * Models that share one mesh but have different draw distances
+ */
+std::vector<std::unique_ptr<SimpleModelInfo>> createModels() {
+    auto data = createDFF(1, 8);
+    auto copy = std::make_unique<char[]>(data.size());
+    std::copy(data.begin(), data.end(), copy.get());
+
+    LoaderDFF loader;
+    auto clump =
+        loader.loadFromMemory(FileContentsInfo(std::move(copy), data.size()));
+
+    std::vector<std::unique_ptr<SimpleModelInfo>> models;
+    for (size_t i = 0; i < kModels; ++i) {
+        auto model = std::make_unique<SimpleModelInfo>();
+        model->flags = 0;
+        model->setNumAtomics(1);
+        model->setAtomic(clump, 0, clump->getAtomics()[0]);
+        model->setLodDistance(0, 50.f + 40.f * i);
+        models.push_back(std::move(model));
+    }
+    return models;
+}
+}  // namespace
+
+RW_BENCHMARK_ARGS(ObjectRenderer_buildRenderList, 1000, 10000) {
+    static const auto models = createModels();
+    auto& world = getWorldFixture().getWorld();
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> coordinate(-kMapExtent, kMapExtent);
+    std::vector<std::unique_ptr<InstanceObject>> instances;
+    for (auto i = 0; i < state.getArg(); ++i) {
+        const auto& model = models[static_cast<size_t>(i) % kModels];
+        const auto x = coordinate(rng);
+        const auto y = coordinate(rng);
+        instances.push_back(std::make_unique<InstanceObject>(
+            &world, glm::vec3(x, y, 0.f),
+            glm::quat{1.f, 0.f, 0.f, 0.f}, glm::vec3(1.f), model.get(),
+            nullptr));
+    }
+
+    ViewCamera camera(glm::vec3(0.f, 0.f, 20.f));
+    camera.frustum.update(camera.frustum.projection() * camera.getView());
+    ObjectRenderer renderer(&world, camera, 1.f);
+    RenderList list;
+
+    while (state.keepRunning()) {
+        list.clear();
+        for (const auto& instance : instances) {
+            renderer.buildRenderList(instance.get(), list);
+        }
+        doNotOptimize(list.size());
+    }
+    state.setItemsProcessed(instances.size());
+}
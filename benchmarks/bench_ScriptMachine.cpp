@@ -0,0 +1,137 @@
+#include "Benchmark.hpp"
+#include "Fixtures.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include <script/SCMFile.hpp>
+#include <script/ScriptMachine.hpp>
+#include <script/modules/GTA3Module.hpp>
+
+namespace {
+constexpr float kTickTime = 1.f / 60.f;
+constexpr uint32_t kGlobalsSize = 64;
+
+/**
+ * Assembles a script file with no models or missions
+ */
+class SCMWriter {
+public:
+    SCMWriter() {
+        const uint32_t modelJump = 8 + kGlobalsSize;
+        const uint32_t missionJump = modelJump + 8 + 4;
+        const uint32_t codeStart = missionJump + 8 + 12;
+
+        // Each section starts by jumping over the next one
+        writeGoto(modelJump);
+        data.push_back(0);
+        data.resize(modelJump, 0);
+        writeGoto(missionJump);
+        data.push_back(0);
+        write(uint32_t{0});
+        writeGoto(codeStart);
+        data.push_back(0);
+        // Main size, largest mission size and mission count
+        write(codeStart);
+        write(uint32_t{0});
+        write(uint32_t{0});
+    }
+
+    uint32_t getOffset() const {
+        return static_cast<uint32_t>(data.size());
+    }
+
+    void writeOpcode(uint16_t opcode) {
+        write(opcode);
+    }
+
+    void writeInt8(int8_t value) {
+        data.push_back(4);
+        write(value);
+    }
+
+    void writeGlobal(uint16_t offset) {
+        data.push_back(2);
+        write(offset);
+    }
+
+    void writeLabel(uint32_t offset) {
+        data.push_back(1);
+        write(offset);
+    }
+
+    void writeGoto(uint32_t offset) {
+        writeOpcode(0x0002);
+        writeLabel(offset);
+    }
+
+    template <class T>
+    void write(const T& value) {
+        const auto offset = data.size();
+        data.resize(offset + sizeof(T));
+        std::memcpy(data.data() + offset, &value, sizeof(T));
+    }
+
+    template <class T>
+    void patch(uint32_t offset, const T& value) {
+        std::memcpy(data.data() + offset, &value, sizeof(T));
+    }
+
+    std::vector<char> data;
+};
+
+/**
+ * Builds a script that counts a global up to 5 and back to 0, waiting for
+ * the next tick on every pass like the game's scripts
+ * @param loop receives the address for threads to start at
+ */
+std::vector<char> createCounterSCM(uint32_t& loop) {
+    SCMWriter scm;
+    loop = scm.getOffset();
+
+    // if global == 5
+    scm.writeOpcode(0x00D6);
+    scm.writeInt8(0);
+    scm.writeOpcode(0x0038);
+    scm.writeGlobal(0);
+    scm.writeInt8(5);
+    scm.writeOpcode(0x004D);
+    scm.writeLabel(0);
+    const auto skipLabel = scm.getOffset() - 4;
+    // global = 0
+    scm.writeOpcode(0x0004);
+    scm.writeGlobal(0);
+    scm.writeInt8(0);
+    scm.patch(skipLabel, scm.getOffset());
+    // global += 1
+    scm.writeOpcode(0x0008);
+    scm.writeGlobal(0);
+    scm.writeInt8(1);
+    // wait 0
+    scm.writeOpcode(0x0001);
+    scm.writeInt8(0);
+    scm.writeGoto(loop);
+
+    return scm.data;
+}
+}  // namespace
+
+// Roughly as many threads as the game's main script keeps running
+RW_BENCHMARK_ARGS(ScriptMachine_execute, 1, 100) {
+    uint32_t loop = 0;
+    auto data = createCounterSCM(loop);
+    SCMFile file;
+    file.loadFile(data.data(), data.size());
+
+    auto& fixture = getWorldFixture();
+    GTA3Module opcodes;
+    ScriptMachine vm(&fixture.getState(), file, &opcodes);
+    for (auto t = 0; t < state.getArg(); ++t) {
+        vm.startThread(loop);
+    }
+
+    while (state.keepRunning()) {
+        vm.execute(kTickTime);
+    }
+    state.setItemsProcessed(static_cast<uint64_t>(state.getArg()));
+}
@@ -0,0 +1,44 @@
+#include "Benchmark.hpp"
+
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <render/ViewCamera.hpp>
+
+namespace {
+constexpr size_t kSpheres = 4096;
+
+struct Sphere {
+    glm::vec3 center;
+    float radius;
+};
+}  // namespace
+
+RW_BENCHMARK(ViewFrustum_intersects) {
+    ViewCamera camera(glm::vec3(0.f, 0.f, 20.f));
+    camera.frustum.update(camera.frustum.projection() * camera.getView());
+
+    // Spread around the camera so some of each kind of result is measured
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> coordinate(-1000.f, 1000.f);
+    std::uniform_real_distribution<float> radius(1.f, 50.f);
+    std::vector<Sphere> spheres;
+    spheres.reserve(kSpheres);
+    for (size_t i = 0; i < kSpheres; ++i) {
+        const auto x = coordinate(rng);
+        const auto y = coordinate(rng);
+        const auto z = coordinate(rng) / 10.f;
+        spheres.push_back({{x, y, z}, radius(rng)});
+    }
+
+    while (state.keepRunning()) {
+        size_t visible = 0;
+        for (const auto& sphere : spheres) {
+            visible += camera.frustum.intersects(sphere.center, sphere.radius);
+        }
+        doNotOptimize(visible);
+    }
+    state.setItemsProcessed(kSpheres);
+}
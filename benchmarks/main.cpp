@@ -0,0 +1,216 @@
+#include "Benchmark.hpp"
+
+#include <gl/Headless.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef RW_GIT_SHA1
+#define RW_GIT_SHA1 "unknown"
+#endif
+
+namespace po = boost::program_options;
+
+namespace {
+constexpr uint64_t kMaxIterations = 1000000000;
+constexpr double kMaxIterationGrowth = 100.;
+
+struct BenchmarkResult {
+    std::string name;
+    uint64_t iterations = 0;
+    double nsPerIteration = 0.;
+    double itemsPerSecond = 0.;
+    /// Why the benchmark didn't produce a time, if it didn't
+    std::string error;
+    bool skipped = false;
+};
+
+/**
+ * Runs a benchmark with more iterations each time until its loop takes at
+ * least minTime seconds
+ */
+BenchmarkResult runBenchmark(const BenchmarkInfo& info, double minTime) {
+    BenchmarkResult result;
+    result.name = info.name;
+
+    uint64_t iterations = 1;
+    for (;;) {
+        BenchmarkRun run(iterations, info.arg);
+        try {
+            info.function(run);
+        } catch (std::exception& ex) {
+            result.error = ex.what();
+            return result;
+        }
+        if (!run.getSkipReason().empty()) {
+            result.error = run.getSkipReason();
+            result.skipped = true;
+            return result;
+        }
+
+        const auto elapsed = run.getElapsedSeconds();
+        if (elapsed >= minTime || iterations >= kMaxIterations) {
+            result.iterations = iterations;
+            result.nsPerIteration = elapsed * 1e9 / iterations;
+            if (elapsed > 0.) {
+                result.itemsPerSecond =
+                    run.getItemsProcessed() * iterations / elapsed;
+            }
+            return result;
+        }
+
+        // Aim a little past the minimum so the next attempt is likely the last
+        double growth = kMaxIterationGrowth;
+        if (elapsed > 0.) {
+            growth = std::min(minTime * 1.4 / elapsed, kMaxIterationGrowth);
+        }
+        iterations = std::min(
+            kMaxIterations,
+            std::max(iterations + 1,
+                     static_cast<uint64_t>(iterations * growth)));
+    }
+}
+
+void writeJSONString(std::ostream& out, const std::string& str) {
+    out << '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            out << '\\';
+        }
+        out << c;
+    }
+    out << '"';
+}
+
+void writeJSON(std::ostream& out, const std::vector<BenchmarkResult>& results,
+               double minTime) {
+    out << "{\n  \"context\": {\"git_sha1\": ";
+    writeJSONString(out, RW_GIT_SHA1);
+    out << ", \"min_time\": " << minTime << "},\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        out << (i > 0 ? "," : "") << "\n    {\"name\": ";
+        writeJSONString(out, r.name);
+        if (!r.error.empty()) {
+            out << ", \"error_occurred\": true, \"skipped\": "
+                << (r.skipped ? "true" : "false") << ", \"error_message\": ";
+            writeJSONString(out, r.error);
+        } else {
+            out << ", \"iterations\": " << r.iterations
+                << ", \"real_time\": " << std::fixed << std::setprecision(3)
+                << r.nsPerIteration << ", \"time_unit\": \"ns\"";
+            if (r.itemsPerSecond > 0.) {
+                out << ", \"items_per_second\": " << std::setprecision(1)
+                    << r.itemsPerSecond;
+            }
+            out << std::defaultfloat;
+        }
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+void printResult(const BenchmarkResult& r, size_t nameWidth) {
+    std::cout << std::left << std::setw(static_cast<int>(nameWidth)) << r.name
+              << std::right;
+    if (!r.error.empty()) {
+        std::cout << (r.skipped ? "  skipped: " : "  failed: ") << r.error
+                  << "\n";
+        return;
+    }
+    std::cout << std::setw(12) << r.iterations << std::setw(16) << std::fixed
+              << std::setprecision(1) << r.nsPerIteration << " ns";
+    if (r.itemsPerSecond > 0.) {
+        std::cout << std::setw(14) << std::setprecision(3)
+                  << r.itemsPerSecond * 1e-6 << " M items/s";
+    }
+    std::cout << "\n";
+}
+}  // namespace
+
+int main(int argc, const char* argv[]) {
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help", "Show this help message")
+        ("list", "List the benchmarks and exit")
+        ("filter,f", po::value<std::string>()->value_name("TEXT"), "Only run benchmarks with TEXT in their name")
+        ("min-time", po::value<double>()->value_name("SECONDS")->default_value(0.5), "Minimum time to run each benchmark for")
+        ("json", po::value<std::string>()->value_name("PATH"), "Write the results to PATH as JSON")
+        ;
+
+    po::variables_map vm;
+    try {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help")) {
+            std::cout << desc;
+            return EXIT_SUCCESS;
+        }
+        po::notify(vm);
+    } catch (po::error& ex) {
+        std::cerr << "Error parsing arguments: " << ex.what() << std::endl;
+        std::cerr << desc;
+        return EXIT_FAILURE;
+    }
+
+    const auto filter =
+        vm.count("filter") ? vm["filter"].as<std::string>() : std::string();
+    const auto minTime = std::max(vm["min-time"].as<double>(), 0.);
+
+    std::vector<BenchmarkInfo> selected;
+    for (const auto& info : getBenchmarks()) {
+        if (info.name.find(filter) != std::string::npos) {
+            selected.push_back(info);
+        }
+    }
+    std::sort(selected.begin(), selected.end(),
+              [](const BenchmarkInfo& a, const BenchmarkInfo& b) {
+                  return a.name < b.name;
+              });
+
+    if (vm.count("list")) {
+        for (const auto& info : selected) {
+            std::cout << info.name << "\n";
+        }
+        return EXIT_SUCCESS;
+    }
+
+    // Fixtures load models without a GL context
+    setGLHeadless(true);
+
+    size_t nameWidth = 0;
+    for (const auto& info : selected) {
+        nameWidth = std::max(nameWidth, info.name.size());
+    }
+
+    std::vector<BenchmarkResult> results;
+    for (const auto& info : selected) {
+        results.push_back(runBenchmark(info, minTime));
+        printResult(results.back(), nameWidth);
+    }
+
+    bool failed = std::any_of(results.begin(), results.end(),
+                              [](const BenchmarkResult& r) {
+                                  return !r.error.empty() && !r.skipped;
+                              });
+
+    if (vm.count("json")) {
+        const auto path = vm["json"].as<std::string>();
+        std::ofstream out(path);
+        if (!out) {
+            std::cerr << "Failed to write " << path << "\n";
+            return EXIT_FAILURE;
+        }
+        writeJSON(out, results, minTime);
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -27,19 +27,36 @@ ModelFrame::ModelFrame(unsigned int index, glm::mat3 dR, glm::vec3 dT)
 void ModelFrame::reset() {
     matrix = glm::translate(glm::mat4(1.0f), defaultTranslation) *
              glm::mat4(defaultRotation);
-    updateHierarchyTransform();
+    markDirty();
 }
 
 void ModelFrame::updateHierarchyTransform() {
-    // Update our own transformation
+    if (dirty_) {
+        updateWorldTransform();
+    }
+    for (const auto& child : children_) {
+        child->updateHierarchyTransform();
+    }
+}
+
+void ModelFrame::markDirty() {
+    // A dirty frame's descendants are already dirty
+    if (dirty_) {
+        return;
+    }
+    dirty_ = true;
+    for (const auto& child : children_) {
+        child->markDirty();
+    }
+}
+
+void ModelFrame::updateWorldTransform() const {
     if (parent_) {
         worldtransform_ = parent_->getWorldTransform() * matrix;
     } else {
         worldtransform_ = matrix;
     }
-    for (const auto& child : children_) {
-        child->updateHierarchyTransform();
-    }
+    dirty_ = false;
 }
 
 void ModelFrame::addChild(const ModelFramePtr& child) {
@@ -52,7 +69,7 @@ void ModelFrame::addChild(const ModelFramePtr& child) {
     }
     child->parent_ = this;
     children_.push_back(child);
-    child->updateHierarchyTransform();
+    child->markDirty();
 }
 
 ModelFrame* ModelFrame::findDescendant(const std::string& name) const {
@@ -17,13 +17,20 @@
 
 /**
  * ModelFrame stores transformation hierarchy
+ *
+ * Changing a frame's transform only marks it and its descendants as dirty,
+ * world transforms are recalculated when they are next requested or when
+ * updateHierarchyTransform() is called. Reading a dirty frame writes the
+ * cache, so frames read from several threads must be resolved beforehand.
  */
 class ModelFrame {
     unsigned int index;
     glm::mat3 defaultRotation;
     glm::vec3 defaultTranslation;
     glm::mat4 matrix{1.0f};
-    glm::mat4 worldtransform_{1.0f};
+    mutable glm::mat4 worldtransform_{1.0f};
+    /// worldtransform_ is out of date, if set so is every descendant's
+    mutable bool dirty_ = true;
     ModelFrame* parent_;
     std::string name;
     std::vector<ModelFramePtr> children_;
@@ -36,7 +43,7 @@ public:
 
     void setTransform(const glm::mat4& m) {
         matrix = m;
-        updateHierarchyTransform();
+        markDirty();
     }
 
     const glm::mat4& getTransform() const {
@@ -61,18 +68,18 @@ public:
 
     void setTranslation(const glm::vec3& t) {
         matrix[3] = glm::vec4(t, matrix[3][3]);
-        updateHierarchyTransform();
+        markDirty();
     }
 
     void setRotation(const glm::mat3& r) {
         for (unsigned int i = 0; i < 3; i++) {
             matrix[i] = glm::vec4(r[i], matrix[i][3]);
         }
-        updateHierarchyTransform();
+        markDirty();
     }
 
     /**
-     * Updates the cached matrix
+     * Updates the cached matrix of this frame and its descendants
      */
     void updateHierarchyTransform();
 
@@ -80,6 +87,9 @@ public:
      * @return the cached world transformation for this Frame
      */
     const glm::mat4& getWorldTransform() const {
+        if (dirty_) {
+            updateWorldTransform();
+        }
         return worldtransform_;
     }
 
@@ -100,6 +110,11 @@ public:
     ModelFrame* findDescendant(const std::string& name) const;
 
     ModelFramePtr cloneHierarchy() const;
+
+private:
+    void markDirty();
+
+    void updateWorldTransform() const;
 };
 
 /**
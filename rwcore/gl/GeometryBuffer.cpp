@@ -1,5 +1,7 @@
 #include "gl/GeometryBuffer.hpp"
 
+#include "gl/Headless.hpp"
+
 GeometryBuffer::~GeometryBuffer() {
     if (vbo != 0) {
         glDeleteBuffers(1, &vbo);
@@ -8,10 +10,13 @@ GeometryBuffer::~GeometryBuffer() {
 
 void GeometryBuffer::uploadVertices(GLsizei num, GLsizeiptr size,
                                     const GLvoid* mem) {
+    this->num = num;
+    if (isGLHeadless()) {
+        return;
+    }
     if (vbo == 0) {
         glGenBuffers(1, &vbo);
     }
-    this->num = num;
     glBindBuffer(GL_ARRAY_BUFFER, vbo);
     glBufferData(GL_ARRAY_BUFFER, size, mem, GL_STATIC_DRAW);
 }
@@ -0,0 +1,13 @@
+#include "gl/Headless.hpp"
+
+namespace {
+bool gHeadless = false;
+}  // namespace
+
+void setGLHeadless(bool headless) {
+    gHeadless = headless;
+}
+
+bool isGLHeadless() {
+    return gHeadless;
+}
@@ -0,0 +1,15 @@
+#ifndef _LIBRW_HEADLESS_HPP_
+#define _LIBRW_HEADLESS_HPP_
+
+/**
+ * @brief setGLHeadless Stops the loaders from creating GL objects
+ *
+ * Used to run the simulation without a window or GL context. Models and
+ * textures are still loaded, but no buffers, vertex arrays or textures are
+ * created and their names stay 0. Must be set before anything is loaded.
+ */
+void setGLHeadless(bool headless);
+
+bool isGLHeadless();
+
+#endif
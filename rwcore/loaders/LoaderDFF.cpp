@@ -11,6 +11,7 @@
 #include <glm/glm.hpp>
 
 #include "data/Clump.hpp"
+#include "gl/Headless.hpp"
 #include "gl/gl_core_3_3.h"
 #include "loaders/RWBinaryStream.hpp"
 #include "platform/FileHandle.hpp"
@@ -255,6 +256,10 @@ GeometryPtr LoaderDFF::readGeometry(const RWBStream &stream) {
     geom->gbuff.uploadVertices(verts);
     geom->dbuff.addGeometry(&geom->gbuff);
 
+    if (isGLHeadless()) {
+        return geom;
+    }
+
     glGenBuffers(1, &geom->EBO);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geom->EBO);
 
@@ -458,7 +463,7 @@ AtomicPtr LoaderDFF::readAtomic(FrameList &framelist,
 ClumpPtr LoaderDFF::loadFromMemory(const FileContentsInfo& file) {
     auto model = std::make_shared<Clump>();
 
-    RWBStream rootStream(file.data.get(), file.length);
+    RWBStream rootStream(file.data, file.length);
 
     auto rootID = rootStream.getNextChunk();
     if (rootID != CHUNK_CLUMP) {
@@ -507,6 +512,12 @@ ClumpPtr LoaderDFF::loadFromMemory(const FileContentsInfo& file) {
         model->setFrame(framelist[0]);
     }
 
+    // Atomics of shared models are rendered by many objects at once, so
+    // their frames must not be left to be resolved on first read
+    for (const auto& frame : framelist) {
+        frame->getWorldTransform();
+    }
+
     // Ensure the model has cached metrics
     model->recalculateMetrics();
 
@@ -1,10 +1,23 @@
 #include "loaders/LoaderIMG.hpp"
 
-#include <boost/algorithm/string/predicate.hpp>
+#include <algorithm>
+#include <cctype>
 #include <cstdio>
 
+#include "platform/FileHandle.hpp"
+#include "platform/MappedFile.hpp"
 #include "rw/debug.hpp"
 
+namespace {
+std::string toLowerName(const char* name, std::size_t length) {
+    std::string lower(name, length);
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](char c) {
+        return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    });
+    return lower;
+}
+}  // namespace
+
 bool LoaderIMG::load(const rwfs::path& filepath) {
     auto dirPath = filepath;
     dirPath.replace_extension(".dir");
@@ -26,9 +39,21 @@ bool LoaderIMG::load(const rwfs::path& filepath) {
         }
 
         fclose(fp);
+
+        m_assetIndex.clear();
+        m_assetIndex.reserve(m_assets.size());
+        for (std::size_t i = 0; i < m_assets.size(); ++i) {
+            const auto& name = m_assets[i].name;
+            auto length = std::find(name, name + sizeof(name), '\0') - name;
+            // Keep the first entry if an archive contains duplicate names
+            m_assetIndex.emplace(
+                toLowerName(name, static_cast<std::size_t>(length)), i);
+        }
+
         auto imgPath = filepath;
         imgPath.replace_extension(".img");
         m_archive = imgPath;
+        m_mapping = MappedFile::open(m_archive);
         return true;
     } else {
         return false;
@@ -37,17 +62,25 @@ bool LoaderIMG::load(const rwfs::path& filepath) {
 
 /// Get the information of a asset in the examining archive
 bool LoaderIMG::findAssetInfo(const std::string& assetname,
-                              LoaderIMGFile& out) {
-    for (auto &asset : m_assets) {
-        if (boost::iequals(asset.name, assetname)) {
-            out = asset;
-            return true;
-        }
+                              LoaderIMGFile& out) const {
+    auto index = findAssetIndex(assetname);
+    if (index < 0) {
+        return false;
     }
-    return false;
+    out = m_assets[static_cast<std::size_t>(index)];
+    return true;
 }
 
-std::unique_ptr<char[]> LoaderIMG::loadToMemory(const std::string& assetname) {
+std::ptrdiff_t LoaderIMG::findAssetIndex(const std::string& assetname) const {
+    auto it = m_assetIndex.find(toLowerName(assetname.data(), assetname.size()));
+    if (it == m_assetIndex.end()) {
+        return -1;
+    }
+    return static_cast<std::ptrdiff_t>(it->second);
+}
+
+std::unique_ptr<char[]> LoaderIMG::loadToMemory(
+    const std::string& assetname) const {
     LoaderIMGFile assetInfo;
     bool found = findAssetInfo(assetname, assetInfo);
 
@@ -56,6 +89,24 @@ std::unique_ptr<char[]> LoaderIMG::loadToMemory(const std::string& assetname) {
         return nullptr;
     }
 
+    return loadToMemory(assetInfo);
+}
+
+FileContentsInfo LoaderIMG::openAsset(const LoaderIMGFile& asset) const {
+    size_t offset = static_cast<size_t>(asset.offset) * 2048;
+    size_t length = static_cast<size_t>(asset.size) * 2048;
+
+    if (m_mapping && offset < m_mapping->size()) {
+        // The final asset may not be padded to a whole sector
+        length = std::min(length, m_mapping->size() - offset);
+        return {m_mapping, offset, length};
+    }
+
+    return {loadToMemory(asset), length};
+}
+
+std::unique_ptr<char[]> LoaderIMG::loadToMemory(
+    const LoaderIMGFile& assetInfo) const {
     auto imgName = m_archive;
 
     FILE* fp = fopen(imgName.string().c_str(), "rb");
@@ -3,11 +3,16 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <rw/filesystem.hpp>
 
+struct FileContentsInfo;
+class MappedFile;
+
 /// \brief Points to one file within the archive
 class LoaderIMGFile {
 public:
@@ -38,15 +43,25 @@ public:
     /// appropriate
     bool load(const rwfs::path& filename);
 
+    /// Returns a view of the asset's data inside the mapped archive, or a
+    /// copy of it if the archive could not be mapped
+    FileContentsInfo openAsset(const LoaderIMGFile& asset) const;
+
     /// Load a file from the archive to memory and pass a pointer to it
     /// Warning: Returns nullptr if by any reason it can't load the file
-    std::unique_ptr<char[]> loadToMemory(const std::string& assetname);
+    std::unique_ptr<char[]> loadToMemory(const std::string& assetname) const;
+
+    /// Load the file described by asset to memory, skipping the name lookup
+    std::unique_ptr<char[]> loadToMemory(const LoaderIMGFile& asset) const;
 
     /// Writes the contents of assetname to filename
     bool saveAsset(const std::string& assetname, const std::string& filename);
 
     /// Get the information of an asset in the examining archive
-    bool findAssetInfo(const std::string& assetname, LoaderIMGFile& out);
+    bool findAssetInfo(const std::string& assetname, LoaderIMGFile& out) const;
+
+    /// Get the index of an asset, or -1 if the archive does not contain it
+    std::ptrdiff_t findAssetIndex(const std::string& assetname) const;
 
     /// Get the information of an asset by its index
     const LoaderIMGFile& getAssetInfoByIndex(size_t index) const;
@@ -61,8 +76,12 @@ public:
 private:
     Version m_version = GTAIIIVC;  ///< Version of this IMG archive
     rwfs::path m_archive;  ///< Path to the archive being used (no extension)
+    std::shared_ptr<MappedFile> m_mapping;  ///< The mapped .img, if any
 
     std::vector<LoaderIMGFile> m_assets;  ///< Asset info of the archive
+
+    /// Lower-case asset name to index in m_assets
+    std::unordered_map<std::string, std::size_t> m_assetIndex;
 };
 
 #endif  // LoaderIMG_h__
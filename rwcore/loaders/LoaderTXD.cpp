@@ -7,11 +7,16 @@
 #include <string>
 #include <vector>
 
+#include "gl/Headless.hpp"
 #include "gl/gl_core_3_3.h"
 #include "loaders/RWBinaryStream.hpp"
 #include "platform/FileHandle.hpp"
 #include "rw/debug.hpp"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 GLuint gErrorTextureData[] = {0xFFFF00FF, 0xFF000000, 0xFF000000, 0xFFFF00FF};
 GLuint gDebugTextureData[] = {0xFF0000FF, 0xFF00FF00};
 GLuint gTextureRed[] = {0xFF0000FF};
@@ -22,6 +27,12 @@ static
 TextureData::Handle getErrorTexture() {
     static GLuint errTexName = 0;
     static TextureData::Handle tex;
+    if (isGLHeadless()) {
+        if (!tex) {
+            tex = TextureData::create(0, {2, 2}, false);
+        }
+        return tex;
+    }
     if (errTexName == 0) {
         glGenTextures(1, &errTexName);
         glBindTexture(GL_TEXTURE_2D, errTexName);
@@ -36,8 +47,39 @@ TextureData::Handle getErrorTexture() {
 
 const size_t paletteSize = 1024;
 
+/**
+ * Expands 8 bit palette indices into 32 bit colours.
+ */
+static
+void expandPalette(const uint32_t* palette, const uint8_t* indices,
+                   size_t count, uint32_t* fullColor) {
+    size_t j = 0;
+#if defined(__AVX2__)
+    // Gather 8 palette entries at a time
+    const int* base = reinterpret_cast<const int*>(palette);
+    for (; j + 8 <= count; j += 8) {
+        __m128i packed =
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(indices + j));
+        __m256i offsets = _mm256_cvtepu8_epi32(packed);
+        __m256i colors = _mm256_i32gather_epi32(base, offsets, 4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(fullColor + j), colors);
+    }
+#else
+    for (; j + 4 <= count; j += 4) {
+        fullColor[j + 0] = palette[indices[j + 0]];
+        fullColor[j + 1] = palette[indices[j + 1]];
+        fullColor[j + 2] = palette[indices[j + 2]];
+        fullColor[j + 3] = palette[indices[j + 3]];
+    }
+#endif
+    for (; j < count; ++j) {
+        fullColor[j] = palette[indices[j]];
+    }
+}
+
 static
-void processPalette(uint32_t* fullColor, RW::BinaryStreamSection& rootSection) {
+void processPalette(uint32_t* fullColor, size_t pixelCount,
+                    RW::BinaryStreamSection& rootSection) {
     uint8_t* dataBase = reinterpret_cast<uint8_t*>(
         rootSection.raw() + sizeof(RW::BSSectionHeader) +
         sizeof(RW::BSTextureNative) - 4);
@@ -46,19 +88,45 @@ void processPalette(uint32_t* fullColor, RW::BinaryStreamSection& rootSection) {
     uint32_t raster_size = *reinterpret_cast<uint32_t*>(dataBase + paletteSize);
     uint32_t* palette = reinterpret_cast<uint32_t*>(dataBase);
 
-    for (size_t j = 0; j < raster_size; ++j) {
-        *(fullColor++) = palette[coldata[j]];
+    expandPalette(palette, coldata, std::min<size_t>(raster_size, pixelCount),
+                  fullColor);
+}
+
+static
+DecodedTexture::Wrap decodeWrap(uint8_t wrap) {
+    switch (wrap) {
+        default:
+        case RW::BSTextureNative::WRAP_WRAP:
+            return DecodedTexture::Wrap::Repeat;
+        case RW::BSTextureNative::WRAP_CLAMP:
+            return DecodedTexture::Wrap::Clamp;
+        case RW::BSTextureNative::WRAP_MIRROR:
+            return DecodedTexture::Wrap::Mirror;
     }
 }
 
 static
-TextureData::Handle createTexture(RW::BSTextureNative& texNative,
-                                  RW::BinaryStreamSection& rootSection) {
+GLenum wrapToGL(DecodedTexture::Wrap wrap) {
+    switch (wrap) {
+        default:
+        case DecodedTexture::Wrap::Repeat:
+            return GL_REPEAT;
+        case DecodedTexture::Wrap::Clamp:
+            return GL_CLAMP_TO_EDGE;
+        case DecodedTexture::Wrap::Mirror:
+            return GL_MIRRORED_REPEAT;
+    }
+}
+
+static
+bool decodeTexture(RW::BSTextureNative& texNative,
+                   RW::BinaryStreamSection& rootSection,
+                   DecodedTexture& texture) {
     // TODO: Exception handling.
     if (texNative.platform != 8) {
         RW_ERROR("Unsupported texture platform " << std::dec
                   << texNative.platform);
-        return getErrorTexture();
+        return false;
     }
 
     bool isPal8 =
@@ -68,113 +136,135 @@ TextureData::Handle createTexture(RW::BSTextureNative& texNative,
                   texNative.rasterformat == RW::BSTextureNative::FORMAT_8888 ||
                   texNative.rasterformat == RW::BSTextureNative::FORMAT_888;
     // Export this value
-    bool transparent =
+    texture.transparent =
         !((texNative.rasterformat & RW::BSTextureNative::FORMAT_888) ==
           RW::BSTextureNative::FORMAT_888);
 
     if (!(isPal8 || isFulc)) {
         RW_ERROR("Unsupported raster format " << std::dec
                   << texNative.rasterformat);
-        return getErrorTexture();
+        return false;
     }
 
-    GLuint textureName = 0;
+    DecodedTexture::Level level;
+    level.width = texNative.width;
+    level.height = texNative.height;
+    const size_t pixelCount =
+        static_cast<size_t>(texNative.width) * texNative.height;
 
     if (isPal8) {
-        std::vector<uint32_t> fullColor(texNative.width * texNative.height);
-
-        processPalette(fullColor.data(), rootSection);
-
-        glGenTextures(1, &textureName);
-        glBindTexture(GL_TEXTURE_2D, textureName);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, texNative.width,
-                     texNative.height, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                     fullColor.data());
-    } else if (isFulc) {
+        level.pixels.resize(pixelCount * sizeof(uint32_t));
+        processPalette(reinterpret_cast<uint32_t*>(level.pixels.data()),
+                       pixelCount, rootSection);
+        texture.format = DecodedTexture::Format::RGBA8;
+    } else {
         auto coldata = rootSection.raw() + sizeof(RW::BSTextureNative);
         coldata += sizeof(uint32_t);
 
-        GLenum type = GL_UNSIGNED_BYTE, format = GL_RGBA;
+        size_t pixelSize = 4;
         switch (texNative.rasterformat) {
             case RW::BSTextureNative::FORMAT_1555:
-                format = GL_RGBA;
-                type = GL_UNSIGNED_SHORT_1_5_5_5_REV;
+                texture.format = DecodedTexture::Format::ARGB1555;
+                pixelSize = 2;
                 break;
             case RW::BSTextureNative::FORMAT_8888:
-                format = GL_BGRA;
-                // type = GL_UNSIGNED_INT_8_8_8_8_REV;
+                texture.format = DecodedTexture::Format::BGRA8;
                 coldata += 8;
-                type = GL_UNSIGNED_BYTE;
                 break;
             case RW::BSTextureNative::FORMAT_888:
-                format = GL_BGRA;
-                type = GL_UNSIGNED_BYTE;
+                texture.format = DecodedTexture::Format::BGRA8;
                 break;
             default:
                 break;
         }
 
-        glGenTextures(1, &textureName);
-        glBindTexture(GL_TEXTURE_2D, textureName);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, texNative.width,
-                     texNative.height, 0, format, type, coldata);
-    } else {
-        return getErrorTexture();
+        level.pixels.assign(coldata, coldata + pixelCount * pixelSize);
     }
 
-    GLenum texFilter = GL_LINEAR;
+    texture.levels.push_back(std::move(level));
+
     switch (texNative.filterflags & 0xFF) {
         default:
         case RW::BSTextureNative::FILTER_LINEAR:
-            texFilter = GL_LINEAR;
+            texture.filter = DecodedTexture::Filter::Linear;
             break;
         case RW::BSTextureNative::FILTER_NEAREST:
-            texFilter = GL_NEAREST;
+            texture.filter = DecodedTexture::Filter::Nearest;
             break;
     }
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
-                    GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, texFilter);
+    texture.wrapU = decodeWrap(texNative.wrapU);
+    texture.wrapV = decodeWrap(texNative.wrapV);
 
-    GLenum texwrap = GL_REPEAT;
-    switch (texNative.wrapU) {
-        default:
-        case RW::BSTextureNative::WRAP_WRAP:
-            texwrap = GL_REPEAT;
-            break;
-        case RW::BSTextureNative::WRAP_CLAMP:
-            texwrap = GL_CLAMP_TO_EDGE;
-            break;
-        case RW::BSTextureNative::WRAP_MIRROR:
-            texwrap = GL_MIRRORED_REPEAT;
-            break;
+    return true;
+}
+
+TextureData::Handle TextureLoader::upload(const DecodedTexture& texture) const {
+    if (!texture.isValid()) {
+        return getErrorTexture();
+    }
+
+    const auto& base = texture.levels.front();
+    if (isGLHeadless()) {
+        return TextureData::create(0, {base.width, base.height},
+                                   texture.transparent);
     }
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, texwrap);
 
-    switch (texNative.wrapV) {
+    GLenum format = GL_RGBA, type = GL_UNSIGNED_BYTE;
+    switch (texture.format) {
         default:
-        case RW::BSTextureNative::WRAP_WRAP:
-            texwrap = GL_REPEAT;
+        case DecodedTexture::Format::RGBA8:
             break;
-        case RW::BSTextureNative::WRAP_CLAMP:
-            texwrap = GL_CLAMP_TO_EDGE;
+        case DecodedTexture::Format::BGRA8:
+            format = GL_BGRA;
             break;
-        case RW::BSTextureNative::WRAP_MIRROR:
-            texwrap = GL_MIRRORED_REPEAT;
+        case DecodedTexture::Format::ARGB1555:
+            type = GL_UNSIGNED_SHORT_1_5_5_5_REV;
             break;
     }
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, texwrap);
 
-    glGenerateMipmap(GL_TEXTURE_2D);
+    GLuint textureName = 0;
+    glGenTextures(1, &textureName);
+    glBindTexture(GL_TEXTURE_2D, textureName);
+
+    for (size_t i = 0; i < texture.levels.size(); ++i) {
+        const auto& level = texture.levels[i];
+        glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), GL_RGBA,
+                     level.width, level.height, 0, format, type,
+                     level.pixels.data());
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                    GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
+                    texture.filter == DecodedTexture::Filter::Nearest
+                        ? GL_NEAREST
+                        : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapToGL(texture.wrapU));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapToGL(texture.wrapV));
+
+    if (texture.levels.size() == 1) {
+        glGenerateMipmap(GL_TEXTURE_2D);
+    } else {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL,
+                        static_cast<GLint>(texture.levels.size() - 1));
+    }
+
+    return TextureData::create(textureName, {base.width, base.height},
+                               texture.transparent);
+}
 
-    return TextureData::create(textureName, {texNative.width, texNative.height},
-                               transparent);
+void TextureLoader::upload(const std::vector<DecodedTexture>& textures,
+                           TextureArchive& inTextures) const {
+    for (const auto& texture : textures) {
+        inTextures[texture.name] = upload(texture);
+    }
 }
 
-bool TextureLoader::loadFromMemory(const FileContentsInfo& file,
-                                   TextureArchive& inTextures) {
-    auto data = file.data.get();
+bool TextureLoader::decodeFromMemory(
+    const FileContentsInfo& file,
+    std::vector<DecodedTexture>& outTextures) const {
+    auto data = file.data;
     RW::BinaryStreamSection root(data);
     /*auto texDict =*/root.readStructure<RW::BSTextureDictionary>();
 
@@ -186,15 +276,34 @@ bool TextureLoader::loadFromMemory(const FileContentsInfo& file,
 
         RW::BSTextureNative texNative =
             rootSection.readStructure<RW::BSTextureNative>();
-        std::string name = std::string(texNative.diffuseName);
-        std::string alpha = std::string(texNative.alphaName);
-        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
-        std::transform(alpha.begin(), alpha.end(), alpha.begin(), ::tolower);
 
-        auto texture = createTexture(texNative, rootSection);
+        DecodedTexture texture;
+        texture.name = std::string(texNative.diffuseName);
+        texture.alphaName = std::string(texNative.alphaName);
+        std::transform(texture.name.begin(), texture.name.end(),
+                       texture.name.begin(), ::tolower);
+        std::transform(texture.alphaName.begin(), texture.alphaName.end(),
+                       texture.alphaName.begin(), ::tolower);
+
+        if (!decodeTexture(texNative, rootSection, texture)) {
+            texture.format = DecodedTexture::Format::Invalid;
+            texture.levels.clear();
+        }
 
-        inTextures[name] = texture;
+        outTextures.push_back(std::move(texture));
     }
 
     return true;
 }
+
+bool TextureLoader::loadFromMemory(const FileContentsInfo& file,
+                                   TextureArchive& inTextures) {
+    std::vector<DecodedTexture> textures;
+    if (!decodeFromMemory(file, textures)) {
+        return false;
+    }
+
+    upload(textures, inTextures);
+
+    return true;
+}
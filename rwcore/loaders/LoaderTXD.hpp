@@ -1,12 +1,80 @@
 #ifndef _LIBRW_TEXTURELOADER_HPP_
 #define _LIBRW_TEXTURELOADER_HPP_
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 #include <gl/TextureData.hpp>
 #include <rw/forward.hpp>
 
+/**
+ * @brief A texture that has been decoded into memory but not uploaded.
+ *
+ * Decoding doesn't touch GL, so it can happen on any thread.
+ */
+struct DecodedTexture {
+    enum class Format {
+        /// The texture couldn't be decoded, the error texture is used
+        Invalid,
+        RGBA8,
+        BGRA8,
+        /// 16 bit with 1 bit alpha, stored as GL_UNSIGNED_SHORT_1_5_5_5_REV
+        ARGB1555
+    };
+
+    enum class Filter { Nearest, Linear };
+
+    enum class Wrap { Repeat, Clamp, Mirror };
+
+    struct Level {
+        uint16_t width = 0;
+        uint16_t height = 0;
+        std::vector<uint8_t> pixels;
+    };
+
+    std::string name;
+    std::string alphaName;
+
+    Format format = Format::Invalid;
+    Filter filter = Filter::Linear;
+    Wrap wrapU = Wrap::Repeat;
+    Wrap wrapV = Wrap::Repeat;
+    bool transparent = false;
+
+    /// Mip levels, largest first. Missing levels are generated on upload
+    std::vector<Level> levels;
+
+    bool isValid() const {
+        return format != Format::Invalid && !levels.empty();
+    }
+};
+
 class TextureLoader {
 public:
+    /**
+     * Decodes and uploads every texture in a TXD.
+     */
     bool loadFromMemory(const FileContentsInfo& file, TextureArchive& inTextures);
+
+    /**
+     * Decodes every texture in a TXD without uploading them, safe to call
+     * from any thread.
+     */
+    bool decodeFromMemory(const FileContentsInfo& file,
+                          std::vector<DecodedTexture>& outTextures) const;
+
+    /**
+     * Uploads a decoded texture, must be called with a GL context.
+     * @return The texture, or the error texture if it isn't valid
+     */
+    TextureData::Handle upload(const DecodedTexture& texture) const;
+
+    /**
+     * Uploads decoded textures into an archive, keyed by name.
+     */
+    void upload(const std::vector<DecodedTexture>& textures,
+                TextureArchive& inTextures) const;
 };
 
 #endif
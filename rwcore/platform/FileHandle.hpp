@@ -4,19 +4,32 @@
 #include <cstddef>
 #include <memory>
 
+#include "platform/MappedFile.hpp"
+
 /**
  * @brief Contains a pointer to a file's contents.
+ *
+ * The contents are either owned by this object, or are a view into a
+ * MappedFile that is kept alive for as long as this object exists.
  */
 struct FileContentsInfo {
-    std::unique_ptr<char[]> data;
+    char* data;
     size_t length;
 
     FileContentsInfo(std::unique_ptr<char[]> mem, size_t len)
-        : data(std::move(mem)), length(len) {
+        : data(mem.get()), length(len), owned(std::move(mem)) {
+    }
+
+    FileContentsInfo(std::shared_ptr<MappedFile> map, size_t offset,
+                     size_t len)
+        : data(map->data() + offset), length(len), mapping(std::move(map)) {
     }
 
     FileContentsInfo(FileContentsInfo&& info)
-        : data(std::move(info.data)), length(info.length) {
+        : data(info.data)
+        , length(info.length)
+        , owned(std::move(info.owned))
+        , mapping(std::move(info.mapping)) {
         info.data = nullptr;
     }
 
@@ -24,6 +37,18 @@ struct FileContentsInfo {
     FileContentsInfo& operator=(FileContentsInfo& info) = delete;
 
     ~FileContentsInfo() = default;
+
+    /**
+     * @brief isMapped
+     * @return true if the contents are a view into a mapped file
+     */
+    bool isMapped() const {
+        return mapping != nullptr;
+    }
+
+private:
+    std::unique_ptr<char[]> owned;
+    std::shared_ptr<MappedFile> mapping;
 };
 
 #endif
@@ -7,6 +7,7 @@
 #include <sstream>
 
 #include "platform/FileHandle.hpp"
+#include "platform/MappedFile.hpp"
 #include "loaders/LoaderIMG.hpp"
 
 #include "rw/debug.hpp"
@@ -34,10 +35,12 @@ void FileIndex::indexTree(const rwfs::path &path) {
         }
         auto relPath = path.lexically_relative(basePath);
         std::string relPathName = normalizeFilePath(relPath.string());
-        indexedData_[relPathName] = {IndexedDataType::FILE, path.string(), ""};
+        indexedData_[relPathName] = {IndexedDataType::FILE, path.string(),
+                                     nullptr, 0};
 
         auto filename = normalizeFilePath(path.filename().string());
-        indexedData_[filename] = {IndexedDataType::FILE, path.string(), ""};
+        indexedData_[filename] = {IndexedDataType::FILE, path.string(),
+                                  nullptr, 0};
     }
 }
 
@@ -52,10 +55,6 @@ rwfs::path FileIndex::findFilePath(const std::string &filePath) const {
 
 FileContentsInfo FileIndex::openFileRaw(const std::string &filePath) const {
     const auto *indexData = getIndexedDataAt(filePath);
-    std::ifstream dfile(indexData->path, std::ios::binary);
-    if (!dfile.is_open()) {
-        throw std::runtime_error("Unable to open file: " + filePath);
-    }
 
 #ifdef RW_DEBUG
     if (indexData->type != IndexedDataType::FILE) {
@@ -63,6 +62,20 @@ FileContentsInfo FileIndex::openFileRaw(const std::string &filePath) const {
     }
 #endif
 
+    return readFile(indexData->path);
+}
+
+FileContentsInfo FileIndex::readFile(const std::string &path) {
+    if (auto mapping = MappedFile::open(path)) {
+        auto length = mapping->size();
+        return {std::move(mapping), 0, length};
+    }
+
+    std::ifstream dfile(path, std::ios::binary);
+    if (!dfile.is_open()) {
+        throw std::runtime_error("Unable to open file: " + path);
+    }
+
     dfile.seekg(0, std::ios::end);
     auto length = dfile.tellg();
     dfile.seekg(0);
@@ -72,26 +85,35 @@ FileContentsInfo FileIndex::openFileRaw(const std::string &filePath) const {
     return {std::move(data), static_cast<size_t>(length)};
 }
 
-void FileIndex::indexArchive(const std::string &archive) {
+std::shared_ptr<LoaderIMG> FileIndex::indexArchive(const std::string &archive) {
     rwfs::path path = findFilePath(archive);
 
-    LoaderIMG img;
-    if (!img.load(path.string())) {
+    auto &img = archives_[path.string()];
+    if (img) {
+        return img;
+    }
+
+    img = std::make_shared<LoaderIMG>();
+    if (!img->load(path.string())) {
+        archives_.erase(path.string());
         throw std::runtime_error("Failed to load IMG archive: " + path.string());
     }
 
-    for (size_t i = 0; i < img.getAssetCount(); ++i) {
-        auto &asset = img.getAssetInfoByIndex(i);
+    for (size_t i = 0; i < img->getAssetCount(); ++i) {
+        auto &asset = img->getAssetInfoByIndex(i);
 
         if (asset.size == 0) continue;
 
         std::string assetName = normalizeFilePath(asset.name);
 
-        indexedData_[assetName] = {IndexedDataType::ARCHIVE, path.string(), asset.name};
+        indexedData_[assetName] = {IndexedDataType::ARCHIVE, path.string(),
+                                   img.get(), i};
     }
+
+    return img;
 }
 
-FileContentsInfo FileIndex::openFile(const std::string &filePath) {
+FileContentsInfo FileIndex::openFile(const std::string &filePath) const {
     auto cleanFilePath = normalizeFilePath(filePath);
     auto indexedDataPos = indexedData_.find(cleanFilePath);
 
@@ -101,34 +123,11 @@ FileContentsInfo FileIndex::openFile(const std::string &filePath) {
 
     const auto &indexedData = indexedDataPos->second;
 
-    std::unique_ptr<char[]> data = nullptr;
-    size_t length = 0;
-
     if (indexedData.type == IndexedDataType::ARCHIVE) {
-        LoaderIMG img;
-
-        if (!img.load(indexedData.path)) {
-            throw std::runtime_error("Failed to load IMG archive: " + indexedData.path);
-        }
-
-        LoaderIMGFile file;
-        auto filename = rwfs::path(indexedData.assetData).filename().string();
-        if (img.findAssetInfo(filename, file)) {
-            length = file.size * 2048;
-            data = img.loadToMemory(filename);
-        }
-    } else {
-        std::ifstream dfile(indexedData.path, std::ios::binary);
-        if (!dfile.is_open()) {
-            throw std::runtime_error("Unable to open file: " + indexedData.path);
-        }
-
-        dfile.seekg(0, std::ios::end);
-        length = dfile.tellg();
-        dfile.seekg(0);
-        data = std::make_unique<char[]>(length);
-        dfile.read(data.get(), length);
+        const auto &file =
+            indexedData.archive->getAssetInfoByIndex(indexedData.assetIndex);
+        return indexedData.archive->openAsset(file);
     }
 
-    return {std::move(data), length};
+    return readFile(indexedData.path);
 }
@@ -4,8 +4,12 @@
 #include "rw/filesystem.hpp"
 #include "rw/forward.hpp"
 
+#include <cstddef>
+#include <memory>
 #include <unordered_map>
 
+class LoaderIMG;
+
 class FileIndex {
 public:
     /**
@@ -42,11 +46,13 @@ public:
 
     /**
      * Adds the files contained within the given Archive file to the
-     * file index.
+     * file index. The archive directory is read once and kept resident,
+     * indexing the same archive again returns the existing instance.
      * @param filePath path to the archive
+     * @return the archive shared by all files indexed from it
      * @throws if this FileIndex has not indexed the archive itself
      */
-    void indexArchive(const std::string &filePath);
+    std::shared_ptr<LoaderIMG> indexArchive(const std::string &filePath);
 
     /**
      * Returns a FileHandle for the file if it can be found in the
@@ -54,7 +60,7 @@ public:
      * @param filePath name of the file to open
      * @return FileHandle to the file, nullptr if this FileINdexed has not indexed the path
      */
-    FileContentsInfo openFile(const std::string &filePath);
+    FileContentsInfo openFile(const std::string &filePath) const;
 
 private:
     /**
@@ -75,8 +81,10 @@ private:
         IndexedDataType type;
         /// Path of indexed data.
         std::string path;
-        /// Extra data of assets (FIXME: use c++17 std::variant or std::option)
-        std::string assetData;
+        /// Archive containing the asset, if type is ARCHIVE
+        const LoaderIMG *archive;
+        /// Index of the asset within archive
+        std::size_t assetIndex;
     };
 
     /**
@@ -84,6 +92,19 @@ private:
      */
     std::unordered_map<std::string, IndexedData> indexedData_;
 
+    /**
+     * @brief archives_ Loaded archives, keyed by their path on disk.
+     */
+    std::unordered_map<std::string, std::shared_ptr<LoaderIMG>> archives_;
+
+    /**
+     * @brief readFile Maps a file on disk, or reads it if mapping fails
+     * @param path the path of the file on disk
+     * @return the contents of the file
+     * @throws if the file cannot be opened
+     */
+    static FileContentsInfo readFile(const std::string &path);
+
     /**
      * @brief getIndexedDataAt Get IndexedData for filePath
      * @param filePath the file path to get the IndexedData for
@@ -0,0 +1,75 @@
+#include "platform/MappedFile.hpp"
+
+#ifdef RW_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+std::shared_ptr<MappedFile> MappedFile::open(const rwfs::path &path) {
+#ifdef RW_WINDOWS
+    HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ,
+                              FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping =
+        CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        return nullptr;
+    }
+
+    void *data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+    if (data == nullptr) {
+        return nullptr;
+    }
+
+    return std::shared_ptr<MappedFile>(
+        new MappedFile(static_cast<char *>(data),
+                       static_cast<std::size_t>(fileSize.QuadPart)));
+#else
+    int fd = ::open(path.string().c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    auto size = static_cast<std::size_t>(st.st_size);
+    void *data =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+
+    return std::shared_ptr<MappedFile>(
+        new MappedFile(static_cast<char *>(data), size));
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef RW_WINDOWS
+    UnmapViewOfFile(data_);
+#else
+    munmap(data_, size_);
+#endif
+}
@@ -0,0 +1,46 @@
+#ifndef _LIBRW_MAPPEDFILE_HPP_
+#define _LIBRW_MAPPEDFILE_HPP_
+
+#include <cstddef>
+#include <memory>
+
+#include "rw/filesystem.hpp"
+
+/**
+ * @brief A file mapped into memory.
+ *
+ * The mapping is private: pages are shared with the page cache until they
+ * are written to, so loaders may treat the contents as ordinary memory
+ * without the writes reaching the file on disk.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief open Maps the file at path
+     * @param path the file to map
+     * @return the mapping, or nullptr if the file could not be mapped
+     */
+    static std::shared_ptr<MappedFile> open(const rwfs::path &path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    char *data() const {
+        return data_;
+    }
+
+    std::size_t size() const {
+        return size_;
+    }
+
+private:
+    MappedFile(char *data, std::size_t size) : data_(data), size_(size) {
+    }
+
+    char *data_;
+    std::size_t size_;
+};
+
+#endif
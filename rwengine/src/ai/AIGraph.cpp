@@ -48,10 +48,25 @@ void AIGraph::createPathNodes(const glm::vec3& position,
             ainode->position = nodePosition;
             ainode->external = node.type == PathNode::EXTERNAL;
             ainode->disabled = false;
+            ainode->index = static_cast<std::uint32_t>(nodes.size());
 
             pathNodes.push_back(ptr);
             nodes.push_back(std::move(ainode));
 
+            // Index the node for findNearest
+            const auto lowerCoord = -(WORLD_GRID_SIZE) / 2.f;
+            const auto cell = glm::floor(
+                (glm::vec2(ptr->position) - glm::vec2(lowerCoord)) /
+                glm::vec2(WORLD_CELL_SIZE));
+            if (cell.x < 0 || cell.y < 0 || cell.x >= WORLD_GRID_WIDTH ||
+                cell.y >= WORLD_GRID_WIDTH) {
+                outsideNodes[ptr->type].push_back(ptr);
+            } else {
+                const auto cellIndex = static_cast<std::size_t>(
+                    cell.x * WORLD_GRID_WIDTH + cell.y);
+                typeGridNodes[ptr->type][cellIndex].push_back(ptr);
+            }
+
             if (ptr->external) {
                 externalNodes.push_back(ptr);
 
@@ -84,6 +99,9 @@ void AIGraph::createPathNodes(const glm::vec3& position,
             next->connections.push_back(node);
         }
     }
+
+    // The new nodes may connect cached routes
+    clearRouteCache();
 }
 
 glm::ivec2 worldToGrid(const glm::vec2& world) {
@@ -119,3 +137,109 @@ void AIGraph::gatherExternalNodesNear(const glm::vec3& center,
         }
     }
 }
+
+bool AIGraph::findRoute(AIGraphNode* start, AIGraphNode* goal,
+                        AIRoute& route) {
+    if (findCachedRoute(start, goal, route)) {
+        return !route.empty();
+    }
+
+    // Search again if the cache was cleared while searching
+    while (true) {
+        AIRouteSearch search(*this, start, goal);
+        search.run();
+        if (cacheRoute(search)) {
+            route = search.getRoute();
+            return !route.empty();
+        }
+    }
+}
+
+bool AIGraph::findCachedRoute(AIGraphNode* start, AIGraphNode* goal,
+                              AIRoute& route) {
+    if (start == nullptr || goal == nullptr) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(routeCacheMutex);
+    auto it = routeCacheIndex.find(getRouteKey(start, goal));
+    if (it == routeCacheIndex.end()) {
+        return false;
+    }
+    routeCache.splice(routeCache.begin(), routeCache, it->second);
+    route = it->second->route;
+    return true;
+}
+
+bool AIGraph::cacheRoute(const AIRouteSearch& search) {
+    if (search.getStatus() == AIRouteSearch::Searching ||
+        search.getStart() == nullptr || search.getGoal() == nullptr) {
+        return true;
+    }
+
+    const auto key = getRouteKey(search.getStart(), search.getGoal());
+    std::lock_guard<std::mutex> lock(routeCacheMutex);
+    if (search.getGeneration() != routeCacheGeneration) {
+        return false;
+    }
+
+    auto it = routeCacheIndex.find(key);
+    if (it != routeCacheIndex.end()) {
+        routeCache.splice(routeCache.begin(), routeCache, it->second);
+        it->second->route = search.getRoute();
+        return true;
+    }
+
+    if (routeCache.size() >= kRouteCacheSize) {
+        routeCacheIndex.erase(routeCache.back().key);
+        routeCache.pop_back();
+    }
+    routeCache.push_front({key, search.getRoute()});
+    routeCacheIndex[key] = routeCache.begin();
+    return true;
+}
+
+void AIGraph::clearRouteCache() {
+    std::lock_guard<std::mutex> lock(routeCacheMutex);
+    routeCache.clear();
+    routeCacheIndex.clear();
+    ++routeCacheGeneration;
+}
+
+std::unique_ptr<AIRouteScratch> AIGraph::acquireRouteScratch() const {
+    std::unique_ptr<AIRouteScratch> scratch;
+    {
+        std::lock_guard<std::mutex> lock(routeScratchMutex);
+        if (!routeScratch.empty()) {
+            scratch = std::move(routeScratch.back());
+            routeScratch.pop_back();
+        }
+    }
+    if (!scratch) {
+        scratch = std::make_unique<AIRouteScratch>();
+    }
+
+    // Nodes may have been added since the buffers were last used
+    const auto count = nodes.size();
+    if (scratch->distances.size() < count) {
+        scratch->distances.resize(count);
+        scratch->parents.resize(count);
+        scratch->visited.resize(count, 0);
+        scratch->closed.resize(count, 0);
+    }
+
+    // Once the stamps run out, forget every old one
+    if (++scratch->stamp == 0) {
+        std::fill(scratch->visited.begin(), scratch->visited.end(), 0);
+        std::fill(scratch->closed.begin(), scratch->closed.end(), 0);
+        scratch->stamp = 1;
+    }
+    scratch->open.clear();
+    return scratch;
+}
+
+void AIGraph::releaseRouteScratch(
+    std::unique_ptr<AIRouteScratch> scratch) const {
+    std::lock_guard<std::mutex> lock(routeScratchMutex);
+    routeScratch.push_back(std::move(scratch));
+}
@@ -1,11 +1,22 @@
 #ifndef _RWENGINE_AIGRAPH_HPP_
 #define _RWENGINE_AIGRAPH_HPP_
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include <glm/glm.hpp>
+#include <glm/gtx/norm.hpp>
 
 #include "ai/AIGraphNode.hpp"
+#include "ai/AIRouteSearch.hpp"
 
 #include <rw/types.hpp>
 
@@ -35,6 +46,173 @@ public:
 
     void gatherExternalNodesNear(const glm::vec3& center, const float radius,
                                  std::vector<AIGraphNode*>& nodes, AIGraphNode::NodeType type);
+
+    /**
+     * @brief findNearest Returns the closest node of a type to position
+     *
+     * Searches the grid cells outward from position, stopping once the
+     * remaining cells are further away than the closest node found.
+     * @param maxRadius Nodes further away than this are ignored
+     * @return nullptr if there is no node within maxRadius
+     */
+    AIGraphNode* findNearest(
+        AIGraphNode::NodeType type, const glm::vec3& position,
+        float maxRadius = std::numeric_limits<float>::max()) const {
+        return findNearest(type, position, maxRadius,
+                           [](const AIGraphNode*) { return true; });
+    }
+
+    /**
+     * @brief findNearest Returns the closest node of a type to position for
+     * which filter(node) is true
+     */
+    template <class Filter>
+    AIGraphNode* findNearest(AIGraphNode::NodeType type,
+                             const glm::vec3& position, float maxRadius,
+                             Filter filter) const;
+
+    /**
+     * @brief findRoute Finds the shortest route between two nodes that
+     * doesn't pass through disabled nodes
+     *
+     * Recent routes are cached, so repeating a search is cheap.
+     * @return false if there is no route
+     */
+    bool findRoute(AIGraphNode* start, AIGraphNode* goal, AIRoute& route);
+
+    /**
+     * @brief findCachedRoute Looks up a route without searching for it
+     *
+     * Routes that don't exist are cached too, and are returned empty.
+     * @return true if the route was cached
+     */
+    bool findCachedRoute(AIGraphNode* start, AIGraphNode* goal,
+                         AIRoute& route);
+
+    /**
+     * @brief cacheRoute Stores the result of a finished search
+     *
+     * Searches started before the cache was last cleared may have used
+     * nodes that have since been disabled, their results are dropped.
+     * @return false if the search was out of date and should be restarted
+     */
+    bool cacheRoute(const AIRouteSearch& search);
+
+    /**
+     * @brief clearRouteCache Forgets the cached routes, must be called when
+     * nodes are enabled or disabled
+     */
+    void clearRouteCache();
+
+    /**
+     * @return The number of times the route cache has been cleared
+     */
+    uint32_t getRouteCacheGeneration() const {
+        return routeCacheGeneration;
+    }
+
+    /**
+     * @brief acquireRouteScratch Lends search buffers sized for every node
+     * to an AIRouteSearch, with a stamp that no node has been marked with
+     */
+    std::unique_ptr<AIRouteScratch> acquireRouteScratch() const;
+
+    /**
+     * @brief releaseRouteScratch Returns search buffers for later searches
+     */
+    void releaseRouteScratch(std::unique_ptr<AIRouteScratch> scratch) const;
+
+private:
+    static constexpr size_t kRouteCacheSize = 64;
+
+    static uint64_t getRouteKey(const AIGraphNode* start,
+                                const AIGraphNode* goal) {
+        return (static_cast<uint64_t>(start->index) << 32) | goal->index;
+    }
+
+    struct CachedRoute {
+        uint64_t key;
+        AIRoute route;
+    };
+
+    /// Every node by type and world grid cell, for findNearest
+    std::array<std::array<std::vector<AIGraphNode*>, WORLD_GRID_CELLS>, 2>
+        typeGridNodes;
+    /// Nodes of each type outside of the world grid, always searched
+    std::array<std::vector<AIGraphNode*>, 2> outsideNodes;
+
+    /// Cached routes, the most recently used first
+    std::list<CachedRoute> routeCache;
+    std::unordered_map<uint64_t, std::list<CachedRoute>::iterator>
+        routeCacheIndex;
+    std::atomic<uint32_t> routeCacheGeneration{0};
+    std::mutex routeCacheMutex;
+
+    /// Search buffers not in use, one per search running at the same time
+    mutable std::vector<std::unique_ptr<AIRouteScratch>> routeScratch;
+    mutable std::mutex routeScratchMutex;
 };
 
+template <class Filter>
+AIGraphNode* AIGraph::findNearest(AIGraphNode::NodeType type,
+                                  const glm::vec3& position, float maxRadius,
+                                  Filter filter) const {
+    AIGraphNode* nearest = nullptr;
+    float nearestDist2 = std::numeric_limits<float>::max();
+    const auto maxRadius2 = maxRadius * maxRadius;
+    const auto check = [&](const std::vector<AIGraphNode*>& nodes) {
+        for (const auto node : nodes) {
+            const auto d = glm::distance2(position, node->position);
+            if (d < nearestDist2 && d <= maxRadius2 && filter(node)) {
+                nearest = node;
+                nearestDist2 = d;
+            }
+        }
+    };
+
+    check(outsideNodes[type]);
+
+    // The cell containing position, which may be outside of the grid
+    const auto lowerCoord = -(WORLD_GRID_SIZE) / 2.f;
+    const auto toCell = [&](float coord) {
+        const auto cell = std::floor((coord - lowerCoord) / WORLD_CELL_SIZE);
+        return static_cast<int>(std::clamp(cell, -2.f * WORLD_GRID_WIDTH,
+                                           3.f * WORLD_GRID_WIDTH));
+    };
+    const int cx = toCell(position.x);
+    const int cy = toCell(position.y);
+    const int width = WORLD_GRID_WIDTH;
+    const int lastRing = std::max({cx, width - 1 - cx, cy, width - 1 - cy});
+
+    const auto& grid = typeGridNodes[type];
+    const auto checkCell = [&](int x, int y) {
+        if (x >= 0 && y >= 0 && x < width && y < width) {
+            check(grid[static_cast<size_t>(x * width + y)]);
+        }
+    };
+
+    for (int r = 0; r <= lastRing; ++r) {
+        // Nodes in ring r are at least r - 1 cells away
+        if (r > 0) {
+            const auto ringDist = (r - 1) * static_cast<float>(WORLD_CELL_SIZE);
+            if (ringDist > maxRadius || ringDist * ringDist > nearestDist2) {
+                break;
+            }
+        }
+
+        for (int x = cx - r; x <= cx + r; ++x) {
+            if (x == cx - r || x == cx + r) {
+                for (int y = cy - r; y <= cy + r; ++y) {
+                    checkCell(x, y);
+                }
+            } else {
+                checkCell(x, cy - r);
+                checkCell(x, cy + r);
+            }
+        }
+    }
+
+    return nearest;
+}
+
 #endif
@@ -23,6 +23,9 @@ struct AIGraphNode {
 
     int32_t nextIndex;
 
+    /// Position of this node in AIGraph::nodes
+    uint32_t index;
+
     bool disabled;
 
     std::vector<AIGraphNode*> connections;
@@ -0,0 +1,114 @@
+#include "ai/AIRouteSearch.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#include <glm/glm.hpp>
+
+#include "ai/AIGraph.hpp"
+#include "ai/AIGraphNode.hpp"
+
+AIRouteSearch::AIRouteSearch(const AIGraph& graph, AIGraphNode* start,
+                             AIGraphNode* goal)
+    : graph(graph)
+    , start(start)
+    , goal(goal)
+    , generation(graph.getRouteCacheGeneration()) {
+    if (start == nullptr || goal == nullptr || start->type != goal->type ||
+        goal->disabled) {
+        status = NotFound;
+        return;
+    }
+
+    scratch = graph.acquireRouteScratch();
+    scratch->distances[start->index] = 0.f;
+    scratch->parents[start->index] = kNoParent;
+    scratch->visited[start->index] = scratch->stamp;
+    scratch->open.push_back(
+        {glm::distance(start->position, goal->position), start->index});
+}
+
+AIRouteSearch::~AIRouteSearch() {
+    if (scratch) {
+        graph.releaseRouteScratch(std::move(scratch));
+    }
+}
+
+AIRouteSearch::Status AIRouteSearch::step(size_t maxExpansions) {
+    if (status != Searching) {
+        return status;
+    }
+
+    auto& open = scratch->open;
+    auto& closed = scratch->closed;
+    const auto stamp = scratch->stamp;
+    const auto compare = std::greater<AIRouteScratch::OpenNode>();
+
+    for (size_t i = 0; i < maxExpansions; ++i) {
+        if (open.empty()) {
+            finish(NotFound);
+            break;
+        }
+
+        std::pop_heap(open.begin(), open.end(), compare);
+        const auto index = open.back().index;
+        open.pop_back();
+        // A node can be queued again with a shorter distance, skip the rest
+        if (closed[index] == stamp) {
+            continue;
+        }
+        closed[index] = stamp;
+
+        const auto node = graph.nodes[index].get();
+        if (node == goal) {
+            buildRoute();
+            finish(Found);
+            break;
+        }
+
+        for (const auto next : node->connections) {
+            if (next->disabled || closed[next->index] == stamp) {
+                continue;
+            }
+            const auto distance = scratch->distances[index] +
+                                  glm::distance(node->position, next->position);
+            if (distance < getDistance(next->index)) {
+                scratch->distances[next->index] = distance;
+                scratch->parents[next->index] = index;
+                scratch->visited[next->index] = stamp;
+                open.push_back({distance + glm::distance(next->position,
+                                                         goal->position),
+                                next->index});
+                std::push_heap(open.begin(), open.end(), compare);
+            }
+        }
+    }
+
+    return status;
+}
+
+AIRouteSearch::Status AIRouteSearch::run() {
+    return step(std::numeric_limits<size_t>::max());
+}
+
+float AIRouteSearch::getDistance(uint32_t index) const {
+    if (scratch->visited[index] != scratch->stamp) {
+        return std::numeric_limits<float>::max();
+    }
+    return scratch->distances[index];
+}
+
+void AIRouteSearch::buildRoute() {
+    for (auto index = goal->index; index != kNoParent;
+         index = scratch->parents[index]) {
+        route.push_back(graph.nodes[index].get());
+    }
+    std::reverse(route.begin(), route.end());
+}
+
+void AIRouteSearch::finish(Status result) {
+    status = result;
+    // Let the next search use the buffers straight away
+    graph.releaseRouteScratch(std::move(scratch));
+}
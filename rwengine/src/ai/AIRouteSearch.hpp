@@ -0,0 +1,125 @@
+#ifndef _RWENGINE_AIROUTESEARCH_HPP_
+#define _RWENGINE_AIROUTESEARCH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct AIGraphNode;
+class AIGraph;
+
+/**
+ * The nodes passed through from the first node to the last
+ */
+using AIRoute = std::vector<AIGraphNode*>;
+
+/**
+ * @brief Per node state of a search, reused by later searches of the graph
+ *
+ * Each search has its own stamp, nodes stamped by an earlier search are
+ * treated as unvisited so that nothing has to be cleared between searches.
+ */
+struct AIRouteScratch {
+    struct OpenNode {
+        float estimate;
+        uint32_t index;
+
+        bool operator>(const OpenNode& other) const {
+            return estimate > other.estimate;
+        }
+    };
+
+    /// Shortest distance found from start to each node
+    std::vector<float> distances;
+    std::vector<uint32_t> parents;
+    /// The stamp of the search that last set the distance of each node
+    std::vector<uint32_t> visited;
+    /// The stamp of the search that last closed each node
+    std::vector<uint32_t> closed;
+    /// Min-heap of nodes waiting to be expanded
+    std::vector<OpenNode> open;
+    uint32_t stamp = 0;
+};
+
+/**
+ * @brief A* search for the shortest route between two nodes of an AIGraph
+ *
+ * The search can be run a few nodes at a time with step(), so that long
+ * searches can be spread over several frames. Disabled nodes are never
+ * entered.
+ *
+ * A search only reads the graph, so it can run on a worker thread as long as
+ * nodes aren't added or enabled and disabled until it has finished. Searches
+ * spread over several frames record the route cache generation they started
+ * in, so AIGraph::cacheRoute() can tell when the graph changed under them.
+ * The per node buffers are borrowed from the graph and returned once the
+ * search has finished.
+ */
+class AIRouteSearch {
+public:
+    enum Status { Searching, Found, NotFound };
+
+    AIRouteSearch(const AIGraph& graph, AIGraphNode* start, AIGraphNode* goal);
+    ~AIRouteSearch();
+
+    AIRouteSearch(const AIRouteSearch&) = delete;
+    AIRouteSearch& operator=(const AIRouteSearch&) = delete;
+
+    /**
+     * @brief step Continues the search
+     * @param maxExpansions The maximum number of nodes to visit
+     * @return The status of the search afterwards
+     */
+    Status step(size_t maxExpansions);
+
+    /**
+     * @brief run Continues the search until it has finished
+     */
+    Status run();
+
+    Status getStatus() const {
+        return status;
+    }
+
+    AIGraphNode* getStart() const {
+        return start;
+    }
+
+    AIGraphNode* getGoal() const {
+        return goal;
+    }
+
+    /**
+     * @return The route cache generation of the graph when the search started
+     */
+    uint32_t getGeneration() const {
+        return generation;
+    }
+
+    /**
+     * @return The route found, empty unless the status is Found
+     */
+    const AIRoute& getRoute() const {
+        return route;
+    }
+
+private:
+    static constexpr uint32_t kNoParent = UINT32_MAX;
+
+    float getDistance(uint32_t index) const;
+    void buildRoute();
+    void finish(Status result);
+
+    const AIGraph& graph;
+    AIGraphNode* start;
+    AIGraphNode* goal;
+    uint32_t generation;
+    Status status = Searching;
+    AIRoute route;
+
+    /// Borrowed from the graph until the search has finished
+    std::unique_ptr<AIRouteScratch> scratch;
+};
+
+#endif
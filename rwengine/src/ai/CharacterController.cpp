@@ -206,18 +206,16 @@ bool CharacterController::checkForObstacles()
     static constexpr float minColDist = 20.f;
 
     // Try to stop before pedestrians
-    for (const auto &obj : character->engine->pedestrianPool.objects) {
+    for (const auto obj : character->engine->pedestrianPool) {
         // Verify that the character isn't the driver and is walking
-        if (obj.second.get() != character &&
-            static_cast<CharacterObject *>(obj.second.get())->getCurrentVehicle() ==
-                nullptr) {
+        if (obj != character && obj->getCurrentVehicle() == nullptr) {
             // Only check characters that are near our vehicle
             if (glm::distance(vehicle->getPosition(),
-                              obj.second->getPosition()) <= minColDist) {
+                              obj->getPosition()) <= minColDist) {
                 // Check if the character is in front of us and in our way
-                if (vehicle->isInFront(obj.second->getPosition()) > -3.f &&
-                    vehicle->isInFront(obj.second->getPosition()) < 10.f &&
-                    glm::abs(vehicle->isOnSide(obj.second->getPosition())) <
+                if (vehicle->isInFront(obj->getPosition()) > -3.f &&
+                    vehicle->isInFront(obj->getPosition()) < 10.f &&
+                    glm::abs(vehicle->isOnSide(obj->getPosition())) <
                         3.f) {
                     return true;
                 }
@@ -226,16 +224,16 @@ bool CharacterController::checkForObstacles()
     }
 
     // Brake when a car is in front of us and change lanes when possible
-    for (const auto &obj : character->engine->vehiclePool.objects) {
+    for (const auto obj : character->engine->vehiclePool) {
         // Verify that the vehicle isn't our vehicle
-        if (obj.second.get() != vehicle) {
+        if (obj != vehicle) {
             // Only check vehicles that are near our vehicle
             if (glm::distance(vehicle->getPosition(),
-                              obj.second->getPosition()) <= minColDist) {
+                              obj->getPosition()) <= minColDist) {
                 // Check if the vehicle is in front of us and in our way
-                if (vehicle->isInFront(obj.second->getPosition()) > 0.f &&
-                    vehicle->isInFront(obj.second->getPosition()) < 10.f &&
-                    glm::abs(vehicle->isOnSide(obj.second->getPosition())) <
+                if (vehicle->isInFront(obj->getPosition()) > 0.f &&
+                    vehicle->isInFront(obj->getPosition()) < 10.f &&
+                    glm::abs(vehicle->isOnSide(obj->getPosition())) <
                         2.5f) {
                     // Check if the road has more than one lane
                     // @todo we don't know the direction of the road, so for
@@ -247,20 +245,15 @@ bool CharacterController::checkForObstacles()
                     if (maxLanes > 1) {
                         // Change the lane, firstly check if there is an
                         // occupant
-                        if (static_cast<VehicleObject *>(obj.second.get())
-                                ->getDriver() != nullptr) {
+                        if (obj->getDriver() != nullptr) {
                             // @todo for now we don't know the lane where the
                             // player is currently driving so just slow down, in
                             // the future calculate the lane
-                            if (static_cast<VehicleObject *>(obj.second.get())
-                                    ->getDriver()
-                                    ->isPlayer()) {
+                            if (obj->getDriver()->isPlayer()) {
                                 return true;
                             } else {
                                 int avoidLane =
-                                    static_cast<VehicleObject *>(obj.second.get())
-                                        ->getDriver()
-                                        ->controller->getLane();
+                                    obj->getDriver()->controller->getLane();
 
                                 // @todo for now just two lanes
                                 if (avoidLane == 1)
@@ -79,21 +79,8 @@ void DefaultAIController::update(float dt) {
             } else {
                 // We need to pick an initial node
                 auto& graph = getCharacter()->engine->aigraph;
-                AIGraphNode* node = nullptr;
-                float mindist = std::numeric_limits<float>::max();
-                for (const auto& n : graph.nodes) {
-                    if (n->type != AIGraphNode::Pedestrian) {
-                        continue;
-		    }
-
-                    float d = glm::distance(n->position,
-                                            getCharacter()->getPosition());
-                    if (d < mindist) {
-                        node = n.get();
-                        mindist = d;
-                    }
-                }
-                targetNode = node;
+                targetNode = graph.findNearest(AIGraphNode::Pedestrian,
+                                               getCharacter()->getPosition());
             }
         } break;
         case TrafficDriver: {
@@ -180,31 +167,15 @@ void DefaultAIController::update(float dt) {
             else {
                 // We need to pick an initial node
                 auto& graph = getCharacter()->engine->aigraph;
-                AIGraphNode* node = nullptr;
-                float mindist = std::numeric_limits<float>::max();
-
-                for (const auto& n : graph.nodes) {
-                    // No vehicle node, continue
-                    if (n->type != AIGraphNode::Vehicle) {
-                        continue;
-                    }
-
-                    // The node must be ahead of the vehicle
-                    if (getCharacter()->getCurrentVehicle()->isInFront(n->position) < 0.f) {
-                        continue;
-                    }
-
-                    const float d = glm::distance(
-                        n->position,
-                        getCharacter()->getCurrentVehicle()->getPosition());
-
-                    if (d < mindist) {
-                        node = n.get();
-                        mindist = d;
-                    }
-                }
-
-                targetNode = node;
+                auto vehicle = getCharacter()->getCurrentVehicle();
+
+                // The node must be ahead of the vehicle
+                targetNode = graph.findNearest(
+                    AIGraphNode::Vehicle, vehicle->getPosition(),
+                    std::numeric_limits<float>::max(),
+                    [&](const AIGraphNode* n) {
+                        return vehicle->isInFront(n->position) >= 0.f;
+                    });
 		
                 // Set the next activity
                 if (targetNode) {
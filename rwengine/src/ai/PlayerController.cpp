@@ -45,13 +45,12 @@ void PlayerController::enterNearestVehicle() {
         VehicleObject* nearest = nullptr;
         float d = 10.f;
 
-        for (auto& p : world->vehiclePool.objects) {
-            auto object = p.second.get();
+        for (auto object : world->vehiclePool) {
             float vd =
                 glm::length(character->getPosition() - object->getPosition());
             if (vd < d) {
                 d = vd;
-                nearest = static_cast<VehicleObject*>(object);
+                nearest = object;
             }
         }
 
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 #include <glm/glm.hpp>
 #include <glm/gtx/norm.hpp>
@@ -37,45 +39,26 @@ std::vector<AIGraphNode*> TrafficDirector::findAvailableNodes(
     graph->gatherExternalNodesNear(camera.position, radius, available, type);
 
     float density = type == AIGraphNode::Vehicle ? carDensity : pedDensity;
-    float minDist = (15.f / density) * (15.f / density);
+    float minDist = 15.f / density;
     float halfRadius2 = std::pow(radius / 2.f, 2.f);
 
-    // Check if any of the nearby nodes are blocked by a pedestrian or vehicle standing on
-    // it
-    // or because it's inside the view frustum
-    for (auto it = available.begin(); it != available.end();) {
-        bool blocked = false;
-        float dist2 = glm::distance2(camera.position, (*it)->position);
-
-        for (const auto& obj : world->pedestrianPool.objects) {
-            if (glm::distance2((*it)->position, obj.second->getPosition()) <=
-                minDist) {
-                blocked = true;
-                break;
-            }
-        }
-
-        for (const auto& obj : world->vehiclePool.objects) {
-            if (glm::distance2((*it)->position, obj.second->getPosition()) <=
-                minDist) {
-                blocked = true;
-                break;
-            }
+    // Check if any of the nearby nodes are blocked by a pedestrian or vehicle
+    // standing on it, or because it's inside the view frustum
+    const auto& occupied = world->getDynamicObjectGrid();
+    const auto blocked = [&](const AIGraphNode* node) {
+        if (occupied.isAnyWithin(node->position, minDist)) {
+            return true;
         }
 
         // Check that we're not going to spawn something right where the player
         // is looking
-        if (dist2 <= halfRadius2 &&
-            camera.frustum.intersects((*it)->position, 1.f)) {
-            blocked = true;
-        }
-
-        if (blocked) {
-            it = available.erase(it);
-        } else {
-            it++;
-        }
-    }
+        float dist2 = glm::distance2(camera.position, node->position);
+        return dist2 <= halfRadius2 &&
+               camera.frustum.intersects(node->position, 1.f);
+    };
+    available.erase(
+        std::remove_if(available.begin(), available.end(), blocked),
+        available.end());
 
     return available;
 }
@@ -105,29 +88,41 @@ std::vector<GameObject*> TrafficDirector::populateNearby(
 
     // Spawn vehicles at vehicle generators
     auto camera2D = glm::vec2(camera.position);
+    std::vector<std::pair<VehicleGenerator*, float>> nearbyGenerators;
+    std::vector<glm::vec3> groundPositions;
     for (auto& gen : world->state->vehicleGenerators) {
         /// @todo verify how vehicle generator proximity is determined
         auto gen2D = glm::vec2(gen.position);
         float dist2 = glm::distance2(camera2D, gen2D);
         if (dist2 < radius * radius) {
-            auto position = gen.position;
-            // Check that the on-ground position is not in view
+            nearbyGenerators.emplace_back(&gen, dist2);
             if (gen.position.z < -90.f) {
-                position = world->getGroundAtPosition(position);
+                groundPositions.push_back(gen.position);
             }
+        }
+    }
 
-            if (dist2 <= halfRadius2 &&
-                camera.frustum.intersects(position, 1.f)) {
-                if (!gen.alwaysSpawn) {
-                    // Don't spawn in the view frustum unless we're forced to
-                    continue;
-                }
-            }
-            auto spawned = world->tryToSpawnVehicle(gen);
-            if (spawned) {
-                created.push_back(spawned);
+    // Find the ground under every generator that needs it in one batch
+    world->getGroundAtPositions(groundPositions);
+
+    size_t groundIndex = 0;
+    for (auto& [gen, dist2] : nearbyGenerators) {
+        auto position = gen->position;
+        // Check that the on-ground position is not in view
+        if (gen->position.z < -90.f) {
+            position = groundPositions[groundIndex++];
+        }
+
+        if (dist2 <= halfRadius2 && camera.frustum.intersects(position, 1.f)) {
+            if (!gen->alwaysSpawn) {
+                // Don't spawn in the view frustum unless we're forced to
+                continue;
             }
         }
+        auto spawned = world->tryToSpawnVehicle(*gen);
+        if (spawned) {
+            created.push_back(spawned);
+        }
     }
 
     // Hardcoded cop Pedestrian
@@ -150,8 +145,8 @@ std::vector<GameObject*> TrafficDirector::populateNearby(
     auto availablePedsNodes = findAvailableNodes(AIGraphNode::Pedestrian, camera, radius);
 
     // We have not reached the limit of spawned pedestrians
-    if (maximumPedestrians > world->pedestrianPool.objects.size()) {
-        const auto availablePeds = maximumPedestrians - world->pedestrianPool.objects.size();
+    if (maximumPedestrians > world->pedestrianPool.size()) {
+        const auto availablePeds = maximumPedestrians - world->pedestrianPool.size();
 
         size_t counter = availablePeds;
         // maxSpawn can be -1 for "as many as possible"
@@ -182,8 +177,8 @@ std::vector<GameObject*> TrafficDirector::populateNearby(
     auto availableVehicleNodes = findAvailableNodes(AIGraphNode::Vehicle, camera, radius);
 
     // We have not reached the limit of spawned vehicles
-    if (maximumCars > world->vehiclePool.objects.size()) {
-        const auto availableCars = maximumCars - world->vehiclePool.objects.size();
+    if (maximumCars > world->vehiclePool.size()) {
+        const auto availableCars = maximumCars - world->vehiclePool.size();
 
         size_t counter = availableCars;
         // maxSpawn can be -1 for "as many as possible"
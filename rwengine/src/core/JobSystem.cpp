@@ -0,0 +1,89 @@
+#include "core/JobSystem.hpp"
+
+#include "core/Profiler.hpp"
+
+JobSystem::JobSystem(unsigned int numWorkers) {
+    for (unsigned int i = 0; i < numWorkers; ++i) {
+        workers_.emplace_back([this] { run(); });
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+unsigned int JobSystem::getDefaultWorkerCount() {
+    const auto hardware = std::thread::hardware_concurrency();
+    return hardware > 1 ? hardware - 1 : 0;
+}
+
+void JobSystem::parallelFor(size_t count, const Job& job) {
+    if (count == 0) {
+        return;
+    }
+    if (workers_.empty() || count == 1) {
+        for (size_t i = 0; i < count; ++i) {
+            job(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> dispatch(dispatch_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = &job;
+        count_ = count;
+        active_ = workers_.size();
+        next_ = 0;
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    work(job, count);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return active_ == 0; });
+    job_ = nullptr;
+}
+
+void JobSystem::run() {
+    RW_PROFILE_THREAD("Jobs");
+
+    uint64_t generation = 0;
+    for (;;) {
+        const Job* job;
+        size_t count;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] {
+                return stopping_ || generation_ != generation;
+            });
+            if (stopping_) {
+                return;
+            }
+            generation = generation_;
+            job = job_;
+            count = count_;
+        }
+
+        work(*job, count);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--active_ == 0) {
+            done_.notify_one();
+        }
+    }
+}
+
+void JobSystem::work(const Job& job, size_t count) {
+    for (size_t i = next_++; i < count; i = next_++) {
+        job(i);
+    }
+}
@@ -0,0 +1,84 @@
+#ifndef _RWENGINE_JOBSYSTEM_HPP_
+#define _RWENGINE_JOBSYSTEM_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Runs batches of independent jobs on a fixed set of worker threads
+ *
+ * The calling thread takes part in each batch, so a JobSystem without
+ * workers runs everything on the caller. The game creates a single one and
+ * shares it between the world and the renderer, so the workers don't
+ * compete with another set of threads for the same cores.
+ */
+class JobSystem {
+public:
+    using Job = std::function<void(size_t index)>;
+
+    /**
+     * @param numWorkers number of threads to start in addition to the caller
+     */
+    explicit JobSystem(unsigned int numWorkers = getDefaultWorkerCount());
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @return One less than the number of hardware threads, so the caller
+     * still has a core to itself
+     */
+    static unsigned int getDefaultWorkerCount();
+
+    /**
+     * @return The number of threads that run jobs, including the caller
+     */
+    size_t getThreadCount() const {
+        return workers_.size() + 1;
+    }
+
+    /**
+     * @brief parallelFor Calls job(i) for each i in [0, count)
+     *
+     * Returns once every call has finished. Calls run in no particular order
+     * or thread, jobs should write their results to per-index storage.
+     * Jobs must not throw.
+     *
+     * Batches don't nest: calling parallelFor() from inside a job deadlocks,
+     * as the outer batch holds dispatch_ until it finishes. Anything that
+     * starts a batch, such as GameWorld::rayTestStatic(), must only be called
+     * from outside of jobs.
+     */
+    void parallelFor(size_t count, const Job& job);
+
+private:
+    void run();
+
+    void work(const Job& job, size_t count);
+
+    /// Held for the duration of a batch, so one batch runs at a time
+    std::mutex dispatch_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    bool stopping_ = false;
+    uint64_t generation_ = 0;
+    const Job* job_ = nullptr;
+    size_t count_ = 0;
+    /// Workers that haven't finished the current batch
+    size_t active_ = 0;
+
+    std::atomic<size_t> next_{0};
+
+    std::vector<std::thread> workers_;
+};
+
+#endif
@@ -2,14 +2,11 @@
 #define _RWENGINE_COLLISIONINSTANCE_HPP_
 
 #include <memory>
-#include <vector>
 
-class btCollisionShape;
-class btCompoundShape;
 class btMotionState;
 class btRigidBody;
-class btTriangleIndexVertexArray;
 struct CollisionModel;
+struct CollisionShape;
 
 class GameObject;
 struct DynamicObjectData;
@@ -36,18 +33,29 @@ public:
         return m_collisionHeight;
     }
 
+    /**
+     * @brief changeMass Sets the mass of the body, a mass of 0 fixes it in
+     * place
+     *
+     * Does nothing if the mass is unchanged. The body is only removed from
+     * the world and added again when it changes between fixed and moving.
+     */
     void changeMass(float newMass);
 
+    float getMass() const {
+        return m_mass;
+    }
+
 private:
     std::unique_ptr<btRigidBody> m_body;
 
-    std::unique_ptr<btCompoundShape> cmpShape;
-    std::vector<std::unique_ptr<btCollisionShape>> m_shapes;
-    std::unique_ptr<btTriangleIndexVertexArray> m_vertArray;
+    /// Shared with every other body of the same collision model
+    std::shared_ptr<CollisionShape> m_shape;
 
     std::unique_ptr<btMotionState> m_motionState;
 
     float m_collisionHeight{0.f};
+    float m_mass{0.f};
 };
 
 #endif
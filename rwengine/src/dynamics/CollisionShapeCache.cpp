@@ -0,0 +1,91 @@
+#include "dynamics/CollisionShapeCache.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4305 5033)
+#endif
+#include <btBulletDynamicsCommon.h>
+#ifdef _MSC_VER
+#pragma warning(default : 4305 5033)
+#endif
+
+#include <glm/glm.hpp>
+
+#include "data/CollisionModel.hpp"
+
+CollisionShape::CollisionShape() = default;
+
+CollisionShape::~CollisionShape() = default;
+
+CollisionShapePtr CollisionShapeCache::getShape(CollisionModel* model) {
+    auto& shape = shapes[model];
+    if (!shape) {
+        shape = createShape(*model);
+    }
+    return shape;
+}
+
+CollisionShapePtr CollisionShapeCache::createShape(CollisionModel& model) {
+    auto shape = std::make_shared<CollisionShape>();
+    shape->compound = std::make_unique<btCompoundShape>();
+
+    float colMin = std::numeric_limits<float>::max(),
+          colMax = std::numeric_limits<float>::lowest();
+
+    btTransform t;
+    t.setIdentity();
+
+    // Boxes
+    for (const auto &box : model.boxes) {
+        auto size = (box.max - box.min) / 2.f;
+        auto mid = (box.min + box.max) / 2.f;
+        auto bshape = std::make_unique<btBoxShape>(
+            btVector3(size.x, size.y, size.z));
+        t.setOrigin(btVector3(mid.x, mid.y, mid.z));
+        shape->compound->addChildShape(t, bshape.get());
+
+        colMin = std::min(colMin, mid.z - size.z);
+        colMax = std::max(colMax, mid.z + size.z);
+
+        shape->children.push_back(std::move(bshape));
+    }
+
+    // Spheres
+    for (const auto &sphere : model.spheres) {
+        auto sshape = std::make_unique<btSphereShape>(sphere.radius);
+        t.setOrigin(
+            btVector3(sphere.center.x, sphere.center.y, sphere.center.z));
+        shape->compound->addChildShape(t, sshape.get());
+
+        colMin = std::min(colMin, sphere.center.z - sphere.radius);
+        colMax = std::max(colMax, sphere.center.z + sphere.radius);
+
+        shape->children.push_back(std::move(sshape));
+    }
+
+    t.setIdentity();
+    auto& verts = model.vertices;
+    auto& faces = model.faces;
+    if (!verts.empty() && !faces.empty()) {
+        shape->vertArray = std::make_unique<btTriangleIndexVertexArray>(
+            static_cast<int>(faces.size()),
+            reinterpret_cast<int*>(faces.data()),
+            static_cast<int>(sizeof(CollisionModel::Triangle)),
+            static_cast<int>(verts.size()),
+            reinterpret_cast<float*>(verts.data()),
+            static_cast<int>(sizeof(glm::vec3)));
+        // The BVH is only built once per model, quantize it to save memory
+        auto trishape = std::make_unique<btBvhTriangleMeshShape>(
+            shape->vertArray.get(), true);
+        trishape->setMargin(0.05f);
+        shape->compound->addChildShape(t, trishape.get());
+
+        shape->children.push_back(std::move(trishape));
+    }
+
+    shape->height = colMax - colMin;
+
+    return shape;
+}
@@ -0,0 +1,67 @@
+#ifndef _RWENGINE_COLLISIONSHAPECACHE_HPP_
+#define _RWENGINE_COLLISIONSHAPECACHE_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class btCollisionShape;
+class btCompoundShape;
+class btTriangleIndexVertexArray;
+struct CollisionModel;
+
+/**
+ * @brief Bullet shapes built from a CollisionModel
+ *
+ * The triangle mesh refers to the model's vertices and faces, so the model
+ * must outlive the shape.
+ */
+struct CollisionShape {
+    std::unique_ptr<btCompoundShape> compound;
+    std::vector<std::unique_ptr<btCollisionShape>> children;
+    std::unique_ptr<btTriangleIndexVertexArray> vertArray;
+
+    /// Distance from the bottom of the lowest box or sphere to the top of
+    /// the highest
+    float height = 0.f;
+
+    CollisionShape();
+    ~CollisionShape();
+};
+
+using CollisionShapePtr = std::shared_ptr<CollisionShape>;
+
+/**
+ * @class CollisionShapeCache
+ *  Shares the shapes of each collision model between all of its bodies
+ *
+ * Shapes are built the first time a model is used, including the triangle
+ * mesh's BVH, and kept until clear() is called. Bodies hold on to the shapes
+ * they were made from, so clearing the cache doesn't affect existing bodies.
+ */
+class CollisionShapeCache {
+public:
+    /**
+     * @brief getShape Returns the shape for a model, building it if needed
+     */
+    CollisionShapePtr getShape(CollisionModel* model);
+
+    void clear() {
+        shapes.clear();
+    }
+
+    size_t size() const {
+        return shapes.size();
+    }
+
+    /**
+     * @brief createShape Builds a new shape for a model, bypassing the cache
+     */
+    static CollisionShapePtr createShape(CollisionModel& model);
+
+private:
+    std::unordered_map<CollisionModel*, CollisionShapePtr> shapes;
+};
+
+#endif
@@ -19,11 +19,6 @@ void Animator::tick(float dt) {
         return;
     }
 
-    struct BoneTransform {
-        glm::vec3 translation{};
-        glm::quat rotation{1.0f,0.0f,0.0f,0.0f};
-    };
-
     for (AnimationState& state : animations) {
         if (state.animation == nullptr) continue;
 
@@ -33,7 +28,7 @@ void Animator::tick(float dt) {
                 if (!frame) {
                     continue;
                 }
-                state.boneInstances.emplace(bonePtr.get(), frame);
+                state.boneInstances.push_back({bonePtr.get(), frame, 0});
             }
         }
 
@@ -46,20 +41,38 @@ void Animator::tick(float dt) {
             animTime = std::fmod(animTime, state.animation->duration);
         }
 
-        for (auto& [bonePtr, frame] : state.boneInstances) {
-            if (bonePtr->frames.empty()) continue;
-            auto kf = bonePtr->getInterpolatedKeyframe(animTime);
-
-            BoneTransform xform;
-            xform.rotation = kf.rotation;
-            if (bonePtr->type != AnimationBone::R00) {
-                xform.translation = kf.position;
+        for (auto& instance : state.boneInstances) {
+            const auto& bone = *instance.bone;
+            if (bone.getKeyframeCount() == 0) continue;
+
+            // Only blend what's applied to the frame, scale is never used
+            glm::quat rotation;
+            glm::vec3 translation{};
+            size_t f1, f2;
+            float alpha;
+            if (bone.findKeyframes(animTime, instance.cursor, f1, f2, alpha)) {
+                rotation = glm::normalize(
+                    glm::slerp(bone.rotations[f1], bone.rotations[f2], alpha));
+                if (bone.type != AnimationBone::R00) {
+                    translation = glm::mix(bone.positions[f1],
+                                           bone.positions[f2], alpha);
+                }
+            } else {
+                rotation = bone.rotations.back();
+                if (bone.type != AnimationBone::R00) {
+                    translation = bone.positions.back();
+                }
             }
-            frame->setTranslation(frame->getDefaultTranslation() +
-                                     xform.translation);
-            frame->setRotation(glm::mat3_cast(xform.rotation));
+
+            auto frame = instance.frame;
+            frame->setTranslation(frame->getDefaultTranslation() + translation);
+            frame->setRotation(glm::mat3_cast(rotation));
         }
     }
+
+    // Bones only mark themselves as changed, work out where they ended up in
+    // one pass so rendering doesn't have to
+    model->getFrame()->updateHierarchyTransform();
 }
 
 bool Animator::isCompleted(unsigned int slot) const {
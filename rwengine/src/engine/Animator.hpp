@@ -1,6 +1,6 @@
 #ifndef _RWENGINE_ANIMATOR_HPP_
 #define _RWENGINE_ANIMATOR_HPP_
-#include <map>
+#include <cstddef>
 #include <vector>
 
 #include <rw/debug.hpp>
@@ -24,6 +24,13 @@ class Animator {
      * @brief The AnimationState struct stores information about playing
      * animations
      */
+    struct BoneInstance {
+        AnimationBone* bone;
+        ModelFrame* frame;
+        /// Keyframe found by the last sample, where the next search starts
+        size_t cursor;
+    };
+
     struct AnimationState {
         AnimationPtr animation;
         /// Timestamp of the last frame
@@ -32,7 +39,7 @@ class Animator {
         float speed;
         /// Automatically restart
         bool repeat;
-        std::map<AnimationBone*, ModelFrame*> boneInstances;
+        std::vector<BoneInstance> boneInstances;
     };
 
     /**
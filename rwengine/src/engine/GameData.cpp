@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <fstream>
@@ -21,6 +22,7 @@
 #include "core/Profiler.hpp"
 #include "engine/GameState.hpp"
 #include "engine/GameWorld.hpp"
+#include "engine/ModelStreamer.hpp"
 #include "loaders/LoaderCOL.hpp"
 #include "loaders/LoaderIDE.hpp"
 #include "loaders/LoaderIFP.hpp"
@@ -40,6 +42,11 @@ GameData::GameData(Logger* log, const rwfs::path& path)
         });
 }
 
+GameData::~GameData() {
+    // Stop the workers before the index they read from is destroyed
+    streamer.reset();
+}
+
 void GameData::load() {
     index.indexTree(datpath);
 
@@ -170,27 +177,36 @@ AnimGroup* GameData::getAnimGroup(const std::string& group) {
 void GameData::loadCOL(const size_t zone, const std::string& name) {
     RW_UNUSED(zone);
 
-    LoaderCOL col;
-
-    auto systempath = index.findFilePath(name).string();
+    auto file = index.openFileRaw(name);
+    const auto hash = assetCache.isEnabled()
+                          ? AssetCache::hashContents(file.data, file.length)
+                          : 0;
+
+    std::vector<std::unique_ptr<CollisionModel>> collisions;
+    if (!assetCache.loadCollisions(name, hash, collisions)) {
+        LoaderCOL col;
+        if (!col.loadFromMemory(file, name)) {
+            return;
+        }
+        collisions = std::move(col.collisions);
+        assetCache.bakeCollisions(name, hash, collisions);
+    }
 
-    if (col.load(systempath)) {
-        // Associate loaded collisions with models
-        for (auto& c : col.collisions) {
-            // Find by name
-            auto id = findModelObject(c->name);
-            auto model = modelinfo.find(id);
-            if (model == modelinfo.end()) {
-                logger->error("Data", "no model for collsion " + c->name);
-                continue;
-            }
-            model->second->setCollisionModel(c);
+    // Associate loaded collisions with models
+    for (auto& c : collisions) {
+        // Find by name
+        auto id = findModelObject(c->name);
+        auto model = modelinfo.find(id);
+        if (model == modelinfo.end()) {
+            logger->error("Data", "no model for collsion " + c->name);
+            continue;
         }
+        model->second->setCollisionModel(c);
     }
 }
 
 void GameData::loadIMG(const std::string& name) {
-    index.indexArchive(name);
+    archives[name] = index.indexArchive(name);
 }
 
 void GameData::loadIPL(const std::string& path) {
@@ -293,7 +309,7 @@ void GameData::loadHandling(const std::string& path) {
 SCMFile GameData::loadSCM(const std::string& path) {
     auto scm_h = index.openFileRaw(path);
     SCMFile scm{};
-    scm.loadFile(scm_h.data.get(), scm_h.length);
+    scm.loadFile(scm_h.data, scm_h.length);
     return scm;
 }
 
@@ -369,6 +385,24 @@ void GameData::loadTXD(const std::string& name) {
     textureslots[slot] = loadTextureArchive(name);
 }
 
+void GameData::loadTXD(const std::string& name,
+                       const std::vector<DecodedTexture>& textures) {
+    RW_PROFILE_COUNTER_ADD("loadTXD", 1);
+    auto slot = name;
+    auto ext = name.find(".txd");
+    if (ext != std::string::npos) {
+        slot = name.substr(0, ext);
+    }
+
+    currenttextureslot = slot;
+
+    if (textureslots.find(slot) != textureslots.end()) {
+        return;
+    }
+
+    textureLoader.upload(textures, textureslots[slot]);
+}
+
 TextureArchive GameData::loadTextureArchive(const std::string& name) {
     RW_PROFILE_COUNTER_ADD("loadTextureArchive", 1);
     /// @todo refactor loadTXD to use correct file locations
@@ -378,6 +412,11 @@ TextureArchive GameData::loadTextureArchive(const std::string& name) {
         return {};
     }
 
+    return loadTextureArchive(name, file);
+}
+
+TextureArchive GameData::loadTextureArchive(const std::string& name,
+                                            const FileContentsInfo& file) {
     TextureArchive textures;
 
     TextureLoader l;
@@ -453,11 +492,12 @@ void GameData::loadModelFile(const std::string& name) {
     }
 }
 
-bool GameData::loadModel(ModelID model) {
+void GameData::getModelFileNames(ModelID model, std::string& name,
+                                 std::string& slotname) {
     auto info = modelinfo[model].get();
     /// @todo replace openFile with API for loading from CDIMAGE archives
-    auto name = info->name;
-    auto slotname = info->textureslot;
+    name = info->name;
+    slotname = info->textureslot;
 
     // Re-direct special models
     switch (info->type()) {
@@ -483,6 +523,11 @@ bool GameData::loadModel(ModelID model) {
     std::transform(name.begin(), name.end(), name.begin(), ::tolower);
     std::transform(slotname.begin(), slotname.end(), slotname.begin(),
                    ::tolower);
+}
+
+bool GameData::loadModel(ModelID model) {
+    std::string name, slotname;
+    getModelFileNames(model, name, slotname);
 
     /// @todo remove this from here
     loadTXD(slotname + ".txd");
@@ -493,6 +538,13 @@ bool GameData::loadModel(ModelID model) {
                                   std::to_string(model) + " [" + name + "]");
         return false;
     }
+
+    return loadModelFromMemory(model, file);
+}
+
+bool GameData::loadModelFromMemory(ModelID model,
+                                   const FileContentsInfo& file) {
+    auto info = modelinfo[model].get();
     auto m = dffLoader.loadFromMemory(file);
     if (!m) {
         logger->error("Data",
@@ -522,12 +574,84 @@ bool GameData::loadModel(ModelID model) {
     return true;
 }
 
+void GameData::requestModel(ModelID model, int priority) {
+    auto it = modelinfo.find(model);
+    if (it == modelinfo.end() || it->second->isLoaded()) {
+        return;
+    }
+    if (unavailableModels.find(model) != unavailableModels.end()) {
+        return;
+    }
+
+    if (!streamer) {
+        constexpr unsigned int kStreamingWorkers = 2;
+        streamer = std::make_unique<ModelStreamer>(index, kStreamingWorkers);
+    } else if (streamer->raisePriority(model, priority) ||
+               streamer->isRequested(model)) {
+        return;
+    }
+
+    ModelStreamer::Request request;
+    request.id = model;
+    request.priority = priority;
+    getModelFileNames(model, request.modelName, request.textureSlot);
+    request.readTextures =
+        textureslots.find(request.textureSlot) == textureslots.end();
+    streamer->request(request);
+}
+
+void GameData::updateStreaming(float budget) {
+    RW_PROFILE_SCOPE(__func__);
+    if (!streamer) {
+        return;
+    }
+
+    namespace chrono = std::chrono;
+    const auto start = chrono::steady_clock::now();
+
+    while (auto result = streamer->collect()) {
+        const auto& request = result->request;
+        auto info = modelinfo[request.id].get();
+
+        // The model may have been loaded synchronously in the meantime
+        if (!info->isLoaded()) {
+            if (result->textures) {
+                loadTXD(request.textureSlot + ".txd", *result->textures);
+            } else {
+                loadTXD(request.textureSlot + ".txd");
+            }
+
+            if (!result->model ||
+                !loadModelFromMemory(request.id, *result->model)) {
+                logger->error("Data", "Failed to stream model for " +
+                                          std::to_string(request.id) + " [" +
+                                          request.modelName + "]");
+                unavailableModels.insert(request.id);
+            }
+        }
+
+        auto elapsed = chrono::duration<float>(chrono::steady_clock::now() -
+                                               start).count();
+        if (elapsed >= budget) {
+            break;
+        }
+    }
+}
+
 void GameData::loadIFP(const std::string& name) {
     auto f = index.openFile(name);
 
     if (f.data) {
+        const auto hash = assetCache.isEnabled()
+                              ? AssetCache::hashContents(f.data, f.length)
+                              : 0;
+        if (assetCache.loadAnimations(name, hash, animations)) {
+            return;
+        }
+
         LoaderIFP loader;
-        if (loader.loadFromMemory(f.data.get())) {
+        if (loader.loadFromMemory(f.data)) {
+            assetCache.bakeAnimations(name, hash, loader.animations);
             animations.insert(loader.animations.begin(),
                               loader.animations.end());
         }
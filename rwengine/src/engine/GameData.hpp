@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -23,6 +24,7 @@
 #include <data/Weather.hpp>
 #include <data/ZoneData.hpp>
 #include <fonts/GameTexts.hpp>
+#include <loaders/AssetCache.hpp>
 #include <loaders/LoaderDFF.hpp>
 #include <loaders/LoaderIMG.hpp>
 #include <loaders/LoaderTXD.hpp>
@@ -32,6 +34,7 @@
 class Logger;
 struct WeaponData;
 class GameWorld;
+class ModelStreamer;
 class TextureAtlas;
 class SCMFile;
 
@@ -52,13 +55,34 @@ private:
     Logger* logger;
     LoaderDFF dffLoader;
 
+    /**
+     * Background reader for streamed models, created on first use
+     */
+    std::unique_ptr<ModelStreamer> streamer;
+
+    /**
+     * Models that failed to stream, so they aren't requested again
+     */
+    std::unordered_set<ModelID> unavailableModels;
+
+    /**
+     * Resolves the model and texture slot file names for a model
+     */
+    void getModelFileNames(ModelID model, std::string& name,
+                           std::string& slotname);
+
+    /**
+     * Parses a model file and associates it with the model's info
+     */
+    bool loadModelFromMemory(ModelID model, const FileContentsInfo& file);
+
 public:
     /**
      * ctor
      * @param path Path to the root of the game data.
      */
     GameData(Logger* log, const rwfs::path& path);
-    ~GameData() = default;
+    ~GameData();
 
     GameWorld* engine = nullptr;
 
@@ -127,11 +151,24 @@ public:
      */
     void loadTXD(const std::string& name);
 
+    /**
+     * Uploads a txd slot that has already been decoded, if it is not
+     * already loaded, and sets the current TXD slot
+     */
+    void loadTXD(const std::string& name,
+                 const std::vector<DecodedTexture>& textures);
+
     /**
      * Loads a named texture archive from the game data
      */
     TextureArchive loadTextureArchive(const std::string& name);
 
+    /**
+     * Loads a texture archive from data that has already been read
+     */
+    TextureArchive loadTextureArchive(const std::string& name,
+                                      const FileContentsInfo& file);
+
     /**
      * Converts combined {name}_l{LOD} into name and lod.
      */
@@ -157,6 +194,20 @@ public:
      */
     bool loadModel(ModelID model);
 
+    /**
+     * Requests that a model is loaded in the background and returns
+     * immediately, BaseModelInfo::isLoaded() is true once it is ready.
+     * @param priority requests with higher priorities are loaded first
+     */
+    void requestModel(ModelID model, int priority = 0);
+
+    /**
+     * Finishes loading models that have been read in the background.
+     * Must be called from the thread that owns the GL context.
+     * @param budget time in seconds to spend before returning
+     */
+    void updateStreaming(float budget = 0.002f);
+
     /**
      * Loads an IFP file containing animations
      */
@@ -207,6 +258,12 @@ public:
 
     FileIndex index;
 
+    /**
+     * Baked copies of parsed collision and animation data, used and
+     * updated when a cache directory has been set
+     */
+    AssetCache assetCache;
+
     /**
      * Files that have been loaded previously
      */
@@ -218,9 +275,9 @@ public:
     std::map<std::string, std::string> iplLocations;
 
     /**
-     * Map of loaded archives
+     * Map of loaded archives, shared with the FileIndex
      */
-    std::map<std::string, LoaderIMG> archives;
+    std::map<std::string, std::shared_ptr<LoaderIMG>> archives;
 
     ZoneDataList gamezones;
 
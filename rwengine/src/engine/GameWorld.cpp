@@ -1,5 +1,9 @@
 #include "engine/GameWorld.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
 #ifdef _MSC_VER
 #pragma warning(disable : 4305 5033)
 #endif
@@ -40,6 +44,8 @@
 
 #include "render/ViewCamera.hpp"
 
+#include "script/ScriptMachine.hpp"
+
 #ifdef RW_WINDOWS
 #include <rw_mingw.hpp>
 #endif
@@ -47,8 +53,60 @@
 // Behaviour Tuning
 constexpr float kMaxTrafficSpawnRadius = 100.f;
 constexpr float kMaxTrafficCleanupRadius = kMaxTrafficSpawnRadius * 1.25f;
+constexpr int kMaxPhysicsSubSteps = 2;
 
 namespace {
+/// Types that are found through the dynamic object grid
+constexpr uint32_t kGridObjectTypes =
+    GameObject::typeMask(GameObject::Character) |
+    GameObject::typeMask(GameObject::Vehicle);
+
+/**
+ * Collects the game objects that own the collision objects in the broadphase
+ */
+class ObjectAabbCallback : public btBroadphaseAabbCallback {
+public:
+    ObjectAabbCallback(uint32_t types, std::vector<GameObject*>& out)
+        : types(types), out(out) {
+    }
+
+    bool process(const btBroadphaseProxy* proxy) override {
+        auto collisionObject =
+            static_cast<const btCollisionObject*>(proxy->m_clientObject);
+        auto object =
+            static_cast<GameObject*>(collisionObject->getUserPointer());
+        if (object && (GameObject::typeMask(object->type()) & types)) {
+            out.push_back(object);
+        }
+        return true;
+    }
+
+private:
+    uint32_t types;
+    std::vector<GameObject*>& out;
+};
+
+/**
+ * Collects the solid collision objects in the broadphase that don't move
+ */
+class StaticObjectAabbCallback : public btBroadphaseAabbCallback {
+public:
+    explicit StaticObjectAabbCallback(std::vector<btCollisionObject*>& out)
+        : out(out) {
+    }
+
+    bool process(const btBroadphaseProxy* proxy) override {
+        auto object = static_cast<btCollisionObject*>(proxy->m_clientObject);
+        if (object->isStaticObject() && object->hasContactResponse()) {
+            out.push_back(object);
+        }
+        return true;
+    }
+
+private:
+    std::vector<btCollisionObject*>& out;
+};
+
 template <typename T>
 bool shouldEffectBeRemoved(const T& effect, float gameTime) {
     if (effect->getType() != Particle) {
@@ -72,8 +130,8 @@ public:
     }
 };
 
-GameWorld::GameWorld(Logger* log, GameData* dat)
-    : logger(log), data(dat), sound(this) {
+GameWorld::GameWorld(Logger* log, GameData* dat, JobSystem* jobs)
+    : logger(log), data(dat), sound(this), jobs(jobs) {
     data->engine = this;
 
     collisionConfig = std::make_unique<btDefaultCollisionConfiguration>();
@@ -109,7 +167,7 @@ bool GameWorld::placeItems(const std::string& name) {
     if (ipll.load(name)) {
         // Find the object.
         for (const auto& inst : ipll.m_instances) {
-            if (!createInstance(inst->id, inst->pos, inst->rot)) {
+            if (!createInstance(inst->id, inst->pos, inst->rot, true)) {
                 logger->error("World", "No object data for instance " +
                                            std::to_string(inst->id) + " in " +
                                            name);
@@ -127,12 +185,12 @@ bool GameWorld::placeItems(const std::string& name) {
 
 InstanceObject* GameWorld::createInstance(const uint16_t id,
                                           const glm::vec3& pos,
-                                          const glm::quat& rot) {
+                                          const glm::quat& rot,
+                                          bool streamModel) {
     auto oi = data->findModelInfo<SimpleModelInfo>(id);
     if (oi) {
-        // Request loading of the model if it isn't loaded already.
-        /// @todo implment streaming properly
-        if (!oi->isLoaded()) {
+        // Load the model now unless it is streamed in by the renderer.
+        if (!oi->isLoaded() && !streamModel) {
             data->loadModel(oi->id());
         }
 
@@ -149,15 +207,20 @@ InstanceObject* GameWorld::createInstance(const uint16_t id,
         }
 
         auto instance =
-            std::make_unique<InstanceObject>(this, pos, rot, glm::vec3(1.f), oi, dydata);
+            std::make_unique<InstanceObject>(this, pos, rot, glm::vec3(1.f), oi,
+                                             dydata, streamModel);
 
         auto ptr = instance.get();
 
-        instancePool.insert(std::move(instance));
-        allObjects.push_back(ptr);
+        insertObject(std::move(instance));
+        instanceGrid.insert(ptr);
 
         modelInstances.emplace(oi->name, ptr);
 
+        if (ptr->needsPhysicsTick()) {
+            wakeInstance(ptr);
+        }
+
         return ptr;
     }
 
@@ -171,27 +234,27 @@ void GameWorld::createTraffic(const ViewCamera& viewCamera) {
 }
 
 void GameWorld::cleanupTraffic(const ViewCamera& focus) {
-    for (auto& p : pedestrianPool.objects) {
-        if (p.second->getLifetime() != GameObject::TrafficLifetime) {
+    for (auto ped : pedestrianPool) {
+        if (ped->getLifetime() != GameObject::TrafficLifetime) {
             continue;
         }
 
-        if (glm::distance(focus.position, p.second->getPosition()) >=
+        if (glm::distance(focus.position, ped->getPosition()) >=
             kMaxTrafficCleanupRadius) {
-            if (!focus.frustum.intersects(p.second->getPosition(), 1.f)) {
-                destroyObjectQueued(p.second.get());
+            if (!focus.frustum.intersects(ped->getPosition(), 1.f)) {
+                destroyObjectQueued(ped);
             }
         }
     }
-    for (auto& p : vehiclePool.objects) {
-        if (p.second->getLifetime() != GameObject::TrafficLifetime) {
+    for (auto vehicle : vehiclePool) {
+        if (vehicle->getLifetime() != GameObject::TrafficLifetime) {
             continue;
         }
 
-        if (glm::distance(focus.position, p.second->getPosition()) >=
+        if (glm::distance(focus.position, vehicle->getPosition()) >=
             kMaxTrafficCleanupRadius) {
-            if (!focus.frustum.intersects(p.second->getPosition(), 1.f)) {
-                destroyObjectQueued(p.second.get());
+            if (!focus.frustum.intersects(vehicle->getPosition(), 1.f)) {
+                destroyObjectQueued(vehicle);
             }
         }
     }
@@ -225,8 +288,7 @@ CutsceneObject* GameWorld::createCutsceneObject(const uint16_t id,
     auto instance = std::make_unique<CutsceneObject>(this, pos, rot, model, modelinfo);
     auto ptr = instance.get();
 
-    cutscenePool.insert(std::move(instance));
-    allObjects.push_back(ptr);
+    insertObject(std::move(instance));
 
     return ptr;
 }
@@ -310,8 +372,8 @@ VehicleObject* GameWorld::createVehicle(const uint16_t id, const glm::vec3& pos,
     auto ptr = vehicle.get();
     vehicle->setGameObjectID(gid);
 
-    vehiclePool.insert(std::move(vehicle));
-    allObjects.push_back(ptr);
+    insertObject(std::move(vehicle));
+    dynamicObjectGridDirty = true;
 
     return ptr;
 }
@@ -334,8 +396,8 @@ CharacterObject* GameWorld::createPedestrian(const uint16_t id,
     auto ped = std::make_unique<CharacterObject>(this, pos, rot, pt, controller);
     auto ptr = ped.get();
     ped->setGameObjectID(gid);
-    pedestrianPool.insert(std::move(ped));
-    allObjects.push_back(ptr);
+    insertObject(std::move(ped));
+    dynamicObjectGridDirty = true;
     return ptr;
 }
 
@@ -364,8 +426,8 @@ CharacterObject* GameWorld::createPlayer(const glm::vec3& pos,
     ped->setGameObjectID(gid);
     ped->setLifetime(GameObject::PlayerLifetime);
     players.push_back(controller);
-    pedestrianPool.insert(std::move(ped));
-    allObjects.push_back(ptr);
+    insertObject(std::move(ped));
+    dynamicObjectGridDirty = true;
     return ptr;
 }
 
@@ -416,8 +478,7 @@ PickupObject* GameWorld::createPickup(const glm::vec3& pos, int id, int type) {
 
     auto ptr = pickup.get();
 
-    pickupPool.insert(std::move(pickup));
-    allObjects.push_back(ptr);
+    insertObject(std::move(pickup));
 
     return ptr;
 }
@@ -435,38 +496,14 @@ Payphone* GameWorld::createPayphone(const glm::vec2 coord) {
     return payphones.back().get();
 }
 
-void GameWorld::ObjectPool::insert(std::unique_ptr<GameObject> object) {
-    if (object->getGameObjectID() == 0) {
-        // Find the lowest free GameObjectID.
-        GameObjectID availID = 1;
-        for (auto& [id, objectPtr] : objects) {
-            if (id == availID) availID++;
-        }
-
-        object->setGameObjectID(availID);
-    }
-    objects[object->getGameObjectID()] = std::move(object);
-}
-
-GameObject* GameWorld::ObjectPool::find(GameObjectID id) const {
-    auto it = objects.find(id);
-    return (it == objects.end()) ? nullptr : it->second.get();
-}
-
-void GameWorld::ObjectPool::remove(GameObject* object) {
-    if (object) {
-        auto it = objects.find(object->getGameObjectID());
-        if (it != objects.end()) {
-            it = objects.erase(it);
-        }
-    }
-}
-
-void GameWorld::ObjectPool::clear() {
-    objects.clear();
+void GameWorld::insertObject(std::unique_ptr<GameObject> object) {
+    auto ptr = object.get();
+    getTypeObjectPool(ptr).insert(std::move(object));
+    ptr->allObjectsIndex = allObjects.size();
+    allObjects.push_back(ptr);
 }
 
-GameWorld::ObjectPool& GameWorld::getTypeObjectPool(GameObject* object) {
+ObjectPool& GameWorld::getTypeObjectPool(GameObject* object) {
     switch (object->type()) {
         case GameObject::Character:
             return pedestrianPool;
@@ -486,6 +523,83 @@ GameWorld::ObjectPool& GameWorld::getTypeObjectPool(GameObject* object) {
     }
 }
 
+const ObjectGrid& GameWorld::getDynamicObjectGrid() {
+    if (dynamicObjectGridDirty) {
+        dynamicObjectGrid.clear();
+        for (auto ped : pedestrianPool) {
+            dynamicObjectGrid.insert(ped, ped->getPosition());
+        }
+        for (auto vehicle : vehiclePool) {
+            dynamicObjectGrid.insert(vehicle, vehicle->getPosition());
+        }
+        dynamicObjectGrid.build();
+        dynamicObjectGridDirty = false;
+    }
+    return dynamicObjectGrid;
+}
+
+void GameWorld::findObjectsNear(const glm::vec3& min, const glm::vec3& max,
+                                uint32_t types,
+                                std::vector<GameObject*>& out) {
+    if (types & kGridObjectTypes) {
+        // The grid searches a circle, so search around the box
+        const auto center = (min + max) * 0.5f;
+        const auto radius = glm::length(glm::vec2(max - min)) * 0.5f;
+        getDynamicObjectGrid().forEachNear(
+            center, radius, [&](const ObjectGrid::Entry& entry) {
+                if (GameObject::typeMask(entry.object->type()) & types) {
+                    out.push_back(entry.object);
+                }
+                return false;
+            });
+    }
+
+    if (types & ~kGridObjectTypes) {
+        const auto first = out.size();
+        ObjectAabbCallback callback(types & ~kGridObjectTypes, out);
+        broadphase->aabbTest(btVector3(min.x, min.y, min.z),
+                             btVector3(max.x, max.y, max.z), callback);
+
+        // Objects can have several collision objects
+        std::sort(out.begin() + first, out.end());
+        out.erase(std::unique(out.begin() + first, out.end()), out.end());
+    }
+}
+
+void GameWorld::findObjectsInSphere(const glm::vec3& center, float radius,
+                                    uint32_t types,
+                                    std::vector<GameObject*>& out) {
+    RW_PROFILE_SCOPE(__func__);
+    const auto first = out.size();
+    findObjectsNear(center - glm::vec3(radius), center + glm::vec3(radius),
+                    types, out);
+
+    const auto radius2 = radius * radius;
+    out.erase(std::remove_if(out.begin() + first, out.end(),
+                             [&](GameObject* object) {
+                                 return glm::distance2(center,
+                                                       object->getPosition()) >
+                                        radius2;
+                             }),
+              out.end());
+}
+
+void GameWorld::findObjectsInBox(const glm::vec3& min, const glm::vec3& max,
+                                 uint32_t types,
+                                 std::vector<GameObject*>& out) {
+    RW_PROFILE_SCOPE(__func__);
+    const auto first = out.size();
+    findObjectsNear(min, max, types, out);
+
+    out.erase(std::remove_if(out.begin() + first, out.end(),
+                             [&](GameObject* object) {
+                                 const auto& p = object->getPosition();
+                                 return glm::any(glm::lessThan(p, min)) ||
+                                        glm::any(glm::greaterThan(p, max));
+                             }),
+              out.end());
+}
+
 GameObject* GameWorld::getBlipTarget(const BlipData& blip) const {
     switch (blip.type) {
         case BlipData::Vehicle:
@@ -502,8 +616,14 @@ GameObject* GameWorld::getBlipTarget(const BlipData& blip) const {
 }
 
 void GameWorld::destroyObject(GameObject* object) {
-    auto& pool = getTypeObjectPool(object);
-    pool.remove(object);
+    if (object->type() == GameObject::Instance) {
+        auto instance = static_cast<InstanceObject*>(object);
+        instanceGrid.remove(instance);
+        if (instance->awake) {
+            awakeInstances.erase(std::find(awakeInstances.begin(),
+                                           awakeInstances.end(), instance));
+        }
+    }
 
     // Remove from mission objects
     if (state) {
@@ -511,11 +631,26 @@ void GameWorld::destroyObject(GameObject* object) {
         mO.erase(std::remove(mO.begin(), mO.end(), object), mO.end());
     }
 
-    auto it = std::find(allObjects.begin(), allObjects.end(), object);
-    RW_CHECK(it != allObjects.end(), "destroying object not in allObjects");
-    if (it != allObjects.end()) {
-        allObjects.erase(it);
+    auto index = object->allObjectsIndex;
+    if (index >= allObjects.size() || allObjects[index] != object) {
+        // Objects added to allObjects directly don't know their index
+        auto it = std::find(allObjects.begin(), allObjects.end(), object);
+        index = static_cast<size_t>(it - allObjects.begin());
     }
+    RW_CHECK(index < allObjects.size(),
+             "destroying object not in allObjects");
+    if (index < allObjects.size()) {
+        // Move the last object into the gap
+        allObjects[index] = allObjects.back();
+        allObjects[index]->allObjectsIndex = index;
+        allObjects.pop_back();
+    }
+
+    // Destroys the object
+    auto& pool = getTypeObjectPool(object);
+    pool.remove(object);
+
+    dynamicObjectGridDirty = true;
 }
 
 void GameWorld::destroyObjectQueued(GameObject* object) {
@@ -562,12 +697,21 @@ void GameWorld::destroyEffect(VisualFX& effect) {
 }
 
 void GameWorld::doWeaponScan(const WeaponScan& scan) {
-    RW_CHECK(scan.type != WeaponScan::RADIUS,
-             "Radius scans not implemented yet");
-
     if (scan.type == WeaponScan::RADIUS) {
-        // TODO
-        // Requires custom ConvexResultCallback
+        std::vector<GameObject*> objects;
+        findObjectsInSphere(scan.center, scan.radius,
+                            GameObject::typeMask(GameObject::Instance) |
+                                GameObject::typeMask(GameObject::Vehicle) |
+                                GameObject::typeMask(GameObject::Character),
+                            objects);
+        for (auto object : objects) {
+            GameObject::DamageInfo di;
+            di.damageLocation = object->getPosition();
+            di.damageSource = scan.center;
+            di.type = GameObject::DamageInfo::Explosion;
+            di.hitpoints = scan.damage;
+            object->takeDamage(di);
+        }
     } else if (scan.type == WeaponScan::HITSCAN) {
         btVector3 from(scan.center.x, scan.center.y, scan.center.z),
             to(scan.end.x, scan.end.y, scan.end.z);
@@ -620,20 +764,107 @@ void GameWorld::offsetGameTime(int minutes) {
     state->basic.gameHour = gameHour;
 }
 
-glm::vec3 GameWorld::getGroundAtPosition(const glm::vec3& pos) const {
-    btVector3 rayFrom(pos.x, pos.y, 100.f);
-    btVector3 rayTo(pos.x, pos.y, -100.f);
+uint64_t GameWorld::getGroundCacheKey(const glm::vec3& position) {
+    const auto x = static_cast<int32_t>(
+        std::floor(position.x / kGroundCacheCellSize));
+    const auto y = static_cast<int32_t>(
+        std::floor(position.y / kGroundCacheCellSize));
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) |
+           static_cast<uint32_t>(y);
+}
 
-    btDynamicsWorld::ClosestRayResultCallback rr(rayFrom, rayTo);
+glm::vec3 GameWorld::getGroundAtPosition(const glm::vec3& pos) {
+    std::vector<glm::vec3> positions{pos};
+    getGroundAtPositions(positions);
+    return positions[0];
+}
 
-    dynamicsWorld->rayTest(rayFrom, rayTo, rr);
+void GameWorld::getGroundAtPositions(std::vector<glm::vec3>& positions) {
+    RW_PROFILE_SCOPE(__func__);
+    std::vector<RayQuery> rays;
+    std::vector<size_t> rayPositions;
+    for (size_t i = 0; i < positions.size(); ++i) {
+        auto& position = positions[i];
+        auto it = groundHeights.find(getGroundCacheKey(position));
+        if (it != groundHeights.end()) {
+            position.z = it->second;
+            continue;
+        }
 
-    if (rr.hasHit()) {
-        auto& ws = rr.m_hitPointWorld;
-        return {ws.x(), ws.y(), ws.z()};
+        RayQuery ray;
+        ray.from = {position.x, position.y, 100.f};
+        ray.to = {position.x, position.y, -100.f};
+        rays.push_back(ray);
+        rayPositions.push_back(i);
     }
 
-    return pos;
+    if (rays.empty()) {
+        return;
+    }
+
+    rayTestStatic(rays);
+
+    if (groundHeights.size() + rays.size() > kMaxGroundCacheSize) {
+        groundHeights.clear();
+    }
+    for (size_t r = 0; r < rays.size(); ++r) {
+        // Positions without ground are left alone, and probed again in case
+        // the collision is loaded later
+        if (!rays[r].hit) {
+            continue;
+        }
+        auto& position = positions[rayPositions[r]];
+        position = rays[r].hitPosition;
+        groundHeights[getGroundCacheKey(position)] = position.z;
+    }
+}
+
+void GameWorld::rayTestStatic(std::vector<RayQuery>& rays) {
+    RW_PROFILE_SCOPE(__func__);
+    RW_PROFILE_COUNTER_SET("rayTestStatic/rays", rays.size());
+
+    // The broadphase can only be searched by one thread at a time
+    rayCandidates.clear();
+    rayCandidateStart.clear();
+    for (const auto& ray : rays) {
+        rayCandidateStart.push_back(rayCandidates.size());
+        StaticObjectAabbCallback callback(rayCandidates);
+        const auto min = glm::min(ray.from, ray.to);
+        const auto max = glm::max(ray.from, ray.to);
+        broadphase->aabbTest(btVector3(min.x, min.y, min.z),
+                             btVector3(max.x, max.y, max.z), callback);
+    }
+    rayCandidateStart.push_back(rayCandidates.size());
+
+    // Static collision isn't changed until this returns, so the rays can be
+    // tested against it in parallel
+    jobs->parallelFor(rays.size(), [&](size_t i) {
+        auto& ray = rays[i];
+        const btVector3 from(ray.from.x, ray.from.y, ray.from.z);
+        const btVector3 to(ray.to.x, ray.to.y, ray.to.z);
+        btTransform fromTransform(btQuaternion::getIdentity(), from);
+        btTransform toTransform(btQuaternion::getIdentity(), to);
+
+        btCollisionWorld::ClosestRayResultCallback result(from, to);
+        for (auto c = rayCandidateStart[i]; c < rayCandidateStart[i + 1];
+             ++c) {
+            auto object = rayCandidates[c];
+            btCollisionWorld::rayTestSingle(
+                fromTransform, toTransform, object,
+                object->getCollisionShape(), object->getWorldTransform(),
+                result);
+        }
+
+        ray.hit = result.hasHit();
+        if (ray.hit) {
+            const auto& p = result.m_hitPointWorld;
+            const auto& n = result.m_hitNormalWorld;
+            ray.hitPosition = {p.x(), p.y(), p.z()};
+            ray.hitNormal = {n.x(), n.y(), n.z()};
+            ray.object = static_cast<GameObject*>(
+                result.m_collisionObject->getUserPointer());
+        }
+    });
 }
 
 float GameWorld::getGameTime() const {
@@ -726,24 +957,38 @@ void GameWorld::PhysicsTickCallback(btDynamicsWorld* physWorld,
     RW_PROFILE_SCOPEC(__func__, MP_CYAN);
     GameWorld* world = static_cast<GameWorld*>(physWorld->getWorldUserInfo());
 
-    RW_PROFILE_COUNTER_SET("physicsTick/vehiclePool", world->vehiclePool.objects.size());
-    for (auto& p : world->vehiclePool.objects) {
+    RW_PROFILE_COUNTER_SET("physicsTick/vehiclePool", world->vehiclePool.size());
+    for (auto object : world->vehiclePool) {
         RW_PROFILE_SCOPEC("VehicleObject", MP_THISTLE1);
-        auto object = static_cast<VehicleObject*>(p.second.get());
         object->tickPhysics(timeStep);
     }
 
-    RW_PROFILE_COUNTER_SET("physicsTick/pedestrianPool", world->pedestrianPool.objects.size());
-    for (auto& p : world->pedestrianPool.objects) {
+    RW_PROFILE_COUNTER_SET("physicsTick/pedestrianPool", world->pedestrianPool.size());
+    for (auto object : world->pedestrianPool) {
         RW_PROFILE_SCOPEC("CharacterObject", MP_THISTLE1);
-        auto object = static_cast<CharacterObject*>(p.second.get());
         object->tickPhysics(timeStep);
     }
 
-    RW_PROFILE_COUNTER_SET("physicsTick/instancePool", world->instancePool.objects.size());
-    for (auto& p : world->instancePool.objects) {
-        auto object = static_cast<InstanceObject*>(p.second.get());
+    auto& awake = world->awakeInstances;
+    RW_PROFILE_COUNTER_SET("physicsTick/awakeInstances", awake.size());
+    for (size_t i = 0; i < awake.size();) {
+        auto object = awake[i];
         object->tickPhysics(timeStep);
+        if (object->needsPhysicsTick()) {
+            ++i;
+            continue;
+        }
+        // Settled, drop it until something wakes it
+        object->awake = false;
+        awake[i] = awake.back();
+        awake.pop_back();
+    }
+}
+
+void GameWorld::wakeInstance(InstanceObject* object) {
+    if (!object->awake) {
+        object->awake = true;
+        awakeInstances.push_back(object);
     }
 }
 
@@ -788,8 +1033,8 @@ void GameWorld::startCutscene() {
 }
 
 void GameWorld::clearCutscene() {
-    for (auto& p : cutscenePool.objects) {
-        destroyObjectQueued(p.second.get());
+    for (auto object : cutscenePool) {
+        destroyObjectQueued(object);
     }
 
     if (cutsceneAudio.length() > 0) {
@@ -857,6 +1102,7 @@ void GameWorld::disableAIPaths(AIGraphNode::NodeType type, const glm::vec3& min,
             }
         }
     }
+    aigraph.clearRouteCache();
 }
 
 void GameWorld::enableAIPaths(AIGraphNode::NodeType type, const glm::vec3& min,
@@ -870,6 +1116,7 @@ void GameWorld::enableAIPaths(AIGraphNode::NodeType type, const glm::vec3& min,
             }
         }
     }
+    aigraph.clearRouteCache();
 }
 
 void GameWorld::drawAreaIndicator(AreaIndicatorInfo::AreaIndicatorType type,
@@ -879,6 +1126,7 @@ void GameWorld::drawAreaIndicator(AreaIndicatorInfo::AreaIndicatorType type,
 
 void GameWorld::clearTickData() {
     areaIndicators.clear();
+    dynamicObjectGridDirty = true;
 }
 
 void GameWorld::setPaused(bool pause) {
@@ -904,6 +1152,148 @@ void GameWorld::updateEffects() {
                   effects.end());
 }
 
+void GameWorld::tickObjects(float dt) {
+    RW_PROFILE_SCOPEC(__func__, MP_MAGENTA1);
+    updateEffects();
+
+    {
+        RW_PROFILE_SCOPEC("allObjects", MP_HOTPINK1);
+        RW_PROFILE_COUNTER_SET("tickObjects/allObjects", allObjects.size());
+        // Objects spawned by the ones being ticked are added to the end
+        const auto count = allObjects.size();
+        for (size_t i = 0; i < count; ++i) {
+            allObjects[i]->_updateLastTransform();
+            allObjects[i]->tickBeforeAnimation(dt);
+        }
+
+        // Each object only poses its own clump, so the order doesn't matter
+        jobs->parallelFor(
+            count, [&](size_t i) { allObjects[i]->tickAnimation(dt); });
+
+        for (size_t i = 0; i < count; ++i) {
+            allObjects[i]->tickAfterAnimation(dt);
+        }
+    }
+
+    {
+        RW_PROFILE_SCOPEC("garages", MP_HOTPINK2);
+        for (auto& g : garages) {
+            g->tick(dt);
+        }
+    }
+
+    {
+        RW_PROFILE_SCOPEC("payphones", MP_HOTPINK3);
+        for (auto& p : payphones) {
+            p->tick(dt);
+        }
+    }
+
+    destroyQueuedObjects();
+    dynamicObjectGridDirty = true;
+}
+
+void GameWorld::stepPhysics(float dt, float fixedStep) {
+    RW_PROFILE_SCOPEC(__func__, MP_DARKORANGE1);
+    dynamicsWorld->stepSimulation(dt, kMaxPhysicsSubSteps, fixedStep);
+}
+
+void GameWorld::tick(float dt, ViewCamera* trafficCamera,
+                     WorldTickTimings* timings) {
+    RW_PROFILE_SCOPE(__func__);
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    // Adds the time since start to a part of the timings and restarts it
+    const auto addTime = [&](double WorldTickTimings::*part) {
+        const auto now = Clock::now();
+        if (timings) {
+            timings->*part +=
+                std::chrono::duration<double>(now - start).count();
+        }
+        start = now;
+    };
+
+    chase.update(dt);
+
+    // Clear out any per-tick state.
+    clearTickData();
+
+    updateClocks(dt);
+
+    start = Clock::now();
+    tickObjects(dt);
+    state->text.tick(dt);
+    addTime(&WorldTickTimings::objects);
+
+    if (state->script) {
+        try {
+            state->script->execute(dt);
+        } catch (SCMException& ex) {
+            logger->error("Script", ex.what());
+            throw;
+        }
+        addTime(&WorldTickTimings::script);
+    }
+
+    if (trafficCamera) {
+        trafficCamera->frustum.update(trafficCamera->frustum.projection() *
+                                      trafficCamera->getView());
+        cleanupTraffic(*trafficCamera);
+        // Only create new traffic outside cutscenes
+        if (!state->currentCutscene) {
+            createTraffic(*trafficCamera);
+        }
+        addTime(&WorldTickTimings::traffic);
+    }
+
+    // Finish the models requested this tick, even when nothing is rendered
+    start = Clock::now();
+    data->updateStreaming();
+    addTime(&WorldTickTimings::streaming);
+}
+
+void GameWorld::updateClocks(float dt) {
+    state->gameTime += dt;
+
+    clockAccumulator += dt;
+    while (clockAccumulator >= 1.f) {
+        state->basic.gameMinute++;
+        while (state->basic.gameMinute >= 60) {
+            state->basic.gameMinute = 0;
+            state->basic.gameHour++;
+            while (state->basic.gameHour >= 24) {
+                state->basic.gameHour = 0;
+            }
+        }
+        clockAccumulator -= 1.f;
+    }
+
+    constexpr float timerClockRate = 1.f / 30.f;
+
+    if (state->scriptTimerVariable && !state->scriptTimerPaused) {
+        scriptTimerAccumulator += dt;
+        while (scriptTimerAccumulator >= timerClockRate) {
+            // Original game uses milliseconds
+            (*state->scriptTimerVariable) -= timerClockRate * 1000;
+
+            //                                11 seconds
+            if (*state->scriptTimerVariable <= 11000 &&
+                scriptTimerBeepTime - *state->scriptTimerVariable >= 1000) {
+                scriptTimerBeepTime = *state->scriptTimerVariable;
+
+                // @todo beep
+            }
+
+            if (*state->scriptTimerVariable <= 0) {
+                (*state->scriptTimerVariable) = 0;
+                state->scriptTimerVariable = nullptr;
+            }
+
+            scriptTimerAccumulator -= timerClockRate;
+        }
+    }
+}
+
 VehicleObject* GameWorld::tryToSpawnVehicle(VehicleGenerator& gen) {
     constexpr float kMinClearRadius = 10.f;
 
@@ -924,11 +1314,14 @@ VehicleObject* GameWorld::tryToSpawnVehicle(VehicleGenerator& gen) {
     }
 
     // Ensure there's no existing vehicles near our spawn point
-    for (auto& v : vehiclePool.objects) {
-        if (glm::distance2(position, v.second->getPosition()) <
-            kMinClearRadius * kMinClearRadius) {
-            return nullptr;
-        }
+    const auto blocked = getDynamicObjectGrid().forEachNear(
+        position, kMinClearRadius, [&](const ObjectGrid::Entry& entry) {
+            return entry.object->type() == GameObject::Vehicle &&
+                   glm::distance2(position, entry.position) <
+                       kMinClearRadius * kMinClearRadius;
+        });
+    if (blocked) {
+        return nullptr;
     }
 
     int id = gen.vehicleID;
@@ -979,20 +1372,29 @@ void GameWorld::clearObjectsWithinArea(const glm::vec3 center,
                                        const bool clearParticles) {
     bool skipFlag = false;
 
+    std::vector<GameObject*> objects;
+    findObjectsInSphere(center, radius,
+                        GameObject::typeMask(GameObject::Vehicle) |
+                            GameObject::typeMask(GameObject::Character),
+                        objects);
+
     // Vehicles
-    for (auto& obj : vehiclePool.objects) {
+    for (auto object : objects) {
+        if (object->type() != GameObject::Vehicle) {
+            continue;
+        }
+        auto vehicle = static_cast<VehicleObject*>(object);
         skipFlag = false;
 
         // Skip if it's the player or owned by player or owned by mission
-        if (obj.second->getLifetime() == GameObject::PlayerLifetime ||
-            obj.second->getLifetime() == GameObject::MissionLifetime) {
+        if (vehicle->getLifetime() == GameObject::PlayerLifetime ||
+            vehicle->getLifetime() == GameObject::MissionLifetime) {
             continue;
         }
 
         // Check if we have any important objects in a vehicle, if we do - don't
         // erase it
-        for (auto& seat :
-             static_cast<VehicleObject*>(obj.second.get())->seatOccupants) {
+        for (auto& seat : vehicle->seatOccupants) {
             auto character = static_cast<CharacterObject*>(seat.second);
 
             if (character->getLifetime() == GameObject::PlayerLifetime ||
@@ -1005,21 +1407,25 @@ void GameWorld::clearObjectsWithinArea(const glm::vec3 center,
             continue;
         }
 
-        if (glm::distance(center, obj.second->getPosition()) < radius) {
-            destroyObjectQueued(obj.second.get());
+        if (glm::distance(center, vehicle->getPosition()) < radius) {
+            destroyObjectQueued(vehicle);
         }
     }
 
     // Peds
-    for (auto& obj : pedestrianPool.objects) {
+    for (auto ped : objects) {
+        if (ped->type() != GameObject::Character) {
+            continue;
+        }
+
         // Skip if it's the player or owned by player or owned by mission
-        if (obj.second->getLifetime() == GameObject::PlayerLifetime ||
-            obj.second->getLifetime() == GameObject::MissionLifetime) {
+        if (ped->getLifetime() == GameObject::PlayerLifetime ||
+            ped->getLifetime() == GameObject::MissionLifetime) {
             continue;
         }
 
-        if (glm::distance(center, obj.second->getPosition()) < radius) {
-            destroyObjectQueued(obj.second.get());
+        if (glm::distance(center, ped->getPosition()) < radius) {
+            destroyObjectQueued(ped);
         }
     }
 
@@ -2,11 +2,13 @@
 #define _RWENGINE_GAMEWORLD_HPP_
 
 #include <cstdint>
+#include <limits>
 #include <map>
 #include <memory>
 #include <random>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -23,16 +25,23 @@
 #include <ai/AIGraph.hpp>
 #include <ai/AIGraphNode.hpp>
 #include <audio/SoundManager.hpp>
+#include <core/JobSystem.hpp>
+#include <dynamics/CollisionShapeCache.hpp>
 
 #include <engine/Garage.hpp>
+#include <engine/InstanceGrid.hpp>
+#include <engine/ObjectGrid.hpp>
+#include <engine/ObjectPool.hpp>
 #include <engine/Payphone.hpp>
 #include <objects/ObjectTypes.hpp>
 
 #include <render/VisualFX.hpp>
+#include <script/ScriptTypes.hpp>
 
 #include <data/Chase.hpp>
 
 class btCollisionDispatcher;
+class btCollisionObject;
 class btDefaultCollisionConfiguration;
 class btDiscreteDynamicsWorld;
 class btDynamicsWorld;
@@ -56,6 +65,7 @@ class CharacterObject;
 class InstanceObject;
 class VehicleObject;
 class PickupObject;
+class ProjectileObject;
 
 class ViewCamera;
 
@@ -75,13 +85,41 @@ struct AreaIndicatorInfo {
     glm::vec3 radius{};
 };
 
+/**
+ * @brief A ray to test against the world, holding the closest hit once it
+ * has been tested
+ */
+struct RayQuery {
+    glm::vec3 from{};
+    glm::vec3 to{};
+
+    bool hit = false;
+    glm::vec3 hitPosition{};
+    glm::vec3 hitNormal{};
+    /// Owner of the collision object that was hit
+    GameObject* object = nullptr;
+};
+
+/**
+ * @brief Wall time spent in each part of GameWorld::tick(), in seconds
+ */
+struct WorldTickTimings {
+    double objects = 0.;
+    double script = 0.;
+    double traffic = 0.;
+    double streaming = 0.;
+};
+
 /**
  * @brief Handles all data relating to object instances and other "worldly"
  * state.
  */
 class GameWorld {
 public:
-    GameWorld(Logger* log, GameData* dat);
+    /**
+     * @param jobs Workers shared with the rest of the game, see JobSystem
+     */
+    GameWorld(Logger* log, GameData* dat, JobSystem* jobs);
 
     ~GameWorld();
 
@@ -112,10 +150,14 @@ public:
 
     /**
      * Creates an instance
+     *
+     * @param streamModel if true the model is streamed in once the instance
+     * is in view, instead of being loaded before this returns
      */
     InstanceObject* createInstance(const uint16_t id, const glm::vec3& pos,
                                    const glm::quat& rot = glm::quat{
-                                       1.0f, 0.0f, 0.0f, 0.0f});
+                                       1.0f, 0.0f, 0.0f, 0.0f},
+                                   bool streamModel = false);
 
     /**
      * @brief Creates an InstanceObject for use in the current Cutscene.
@@ -224,7 +266,44 @@ public:
     //! Check if the weather conditions are rainy
     bool isRaining() const;
 
-    glm::vec3 getGroundAtPosition(const glm::vec3& pos) const;
+    /**
+     * @brief getGroundAtPosition Finds the static collision under a position
+     *
+     * Heights are cached on a grid, so repeated probes at the same place
+     * don't cast a ray. The cache is cleared when static collision is added,
+     * removed or moved.
+     *
+     * @return The ground position, or pos if there is no ground
+     */
+    glm::vec3 getGroundAtPosition(const glm::vec3& pos);
+
+    /**
+     * @brief getGroundAtPositions Replaces each position with the ground
+     * under it, testing the positions that aren't cached in one batch
+     */
+    void getGroundAtPositions(std::vector<glm::vec3>& positions);
+
+    /**
+     * @brief rayTestStatic Finds the closest static collision hit by each ray
+     *
+     * Objects near each ray are found through the broadphase first, then the
+     * rays are tested against them on the worker threads. Only collision that
+     * doesn't move is tested, so pedestrians, vehicles and moving instances
+     * aren't hit.
+     *
+     * Starts a JobSystem batch, so it must not be called from inside a job.
+     */
+    void rayTestStatic(std::vector<RayQuery>& rays);
+
+    /**
+     * @brief clearGroundCache Forgets the cached ground heights, called when
+     * static collision changes
+     */
+    void clearGroundCache() {
+        if (!groundHeights.empty()) {
+            groundHeights.clear();
+        }
+    }
 
     float getGameTime() const;
 
@@ -249,47 +328,69 @@ public:
     ChaseCoordinator chase;
 
     /**
-     * Each object type is allocated from a pool. This object helps manage
-     * the individual pools.
+     * Stores all game objects
      */
-    struct ObjectPool {
-        std::map<GameObjectID, std::unique_ptr<GameObject>> objects;
+    std::vector<GameObject*> allObjects;
 
-        /**
-         * Allocates the game object a GameObjectID and inserts it into
-         * the pool
-         */
-        void insert(std::unique_ptr<GameObject> object);
+    /**
+     * Each object type is allocated from a pool, which owns the objects
+     */
+    TypedObjectPool<CharacterObject> pedestrianPool;
+    TypedObjectPool<InstanceObject> instancePool;
+    TypedObjectPool<VehicleObject> vehiclePool;
+    TypedObjectPool<PickupObject> pickupPool;
+    TypedObjectPool<CutsceneObject> cutscenePool;
+    TypedObjectPool<ProjectileObject> projectilePool;
 
-        /**
-         * Removes a game object from this pool
-         */
-        void remove(GameObject* object);
+    /**
+     * @brief insertObject Adds an object to its pool and to allObjects
+     */
+    void insertObject(std::unique_ptr<GameObject> object);
 
-        /**
-         * Finds a game object if it exists in this pool
-         */
-        GameObject* find(GameObjectID id) const;
+    ObjectPool& getTypeObjectPool(GameObject* object);
 
-        /**
-         * Removes all stored objects
-         */
-        void clear();
-    };
+    /**
+     * @brief getDynamicObjectGrid Returns the pedestrians and vehicles
+     * bucketed by position, for proximity queries
+     *
+     * The grid is rebuilt on first use after a tick or after pedestrians or
+     * vehicles are created, destroyed or moved with setPosition().
+     */
+    const ObjectGrid& getDynamicObjectGrid();
 
     /**
-     * Stores all game objects
+     * @brief markDynamicObjectGridDirty Rebuilds the grid on its next use,
+     * for pedestrians and vehicles moved outside of the physics step
      */
-    std::vector<GameObject*> allObjects;
+    void markDynamicObjectGridDirty() {
+        dynamicObjectGridDirty = true;
+    }
 
-    ObjectPool pedestrianPool;
-    ObjectPool instancePool;
-    ObjectPool vehiclePool;
-    ObjectPool pickupPool;
-    ObjectPool cutscenePool;
-    ObjectPool projectilePool;
+    /**
+     * @brief findObjectsInSphere Appends the objects whose position is no
+     * further than radius from center to out
+     *
+     * Pedestrians and vehicles are found through getDynamicObjectGrid(), the
+     * other types through the physics broadphase, so those are only found if
+     * they have a collision object.
+     *
+     * @param types Types to look for, a mask of GameObject::typeMask() bits
+     */
+    void findObjectsInSphere(const glm::vec3& center, float radius,
+                             uint32_t types, std::vector<GameObject*>& out);
 
-    ObjectPool& getTypeObjectPool(GameObject* object);
+    /**
+     * @brief findObjectsInBox Appends the objects whose position is inside
+     * of the box to out, in the same way as findObjectsInSphere()
+     */
+    void findObjectsInBox(const glm::vec3& min, const glm::vec3& max,
+                          uint32_t types, std::vector<GameObject*>& out);
+
+    /**
+     * @brief wakeInstance Adds an instance to the physics tick, where it
+     * stays until InstanceObject::needsPhysicsTick() returns false
+     */
+    void wakeInstance(InstanceObject* object);
 
     std::vector<PlayerController*> players;
 
@@ -314,6 +415,11 @@ public:
      */
     AIGraph aigraph;
 
+    /**
+     * Instances organised by world grid cell, for culling
+     */
+    InstanceGrid instanceGrid;
+
     /**
      * Visual Effects
      * @todo Consider using lighter handing mechanism
@@ -334,6 +440,11 @@ public:
     std::unique_ptr<btSequentialImpulseConstraintSolver> solver;
     std::unique_ptr<btDiscreteDynamicsWorld> dynamicsWorld;
 
+    /**
+     * Shapes shared by the bodies of each collision model
+     */
+    CollisionShapeCache collisionShapes;
+
     /**
      * @brief physicsNearCallback
      * Used to implement uprooting and other physics oddities.
@@ -391,6 +502,36 @@ public:
      */
     void updateEffects();
 
+    /**
+     * @brief tickObjects Advances every object, garage and payphone by dt
+     *
+     * Objects are ticked in the phases described by
+     * GameObject::tickBeforeAnimation(), with animation run in parallel.
+     * Objects created during the tick are first ticked on the next one.
+     * Also removes expired effects and destroys queued objects afterwards.
+     */
+    void tickObjects(float dt);
+
+    /**
+     * @brief stepPhysics Steps the physics simulation, before tick()
+     * @param dt Game time to simulate, scaled by the time scale
+     * @param fixedStep Unscaled length of each physics step
+     */
+    void stepPhysics(float dt, float fixedStep);
+
+    /**
+     * @brief tick Advances everything but the physics by dt
+     *
+     * In order: the chase, the per-tick state, the clock and the script
+     * timer, the objects and the on screen text, the script, the traffic
+     * and finally the models that have finished streaming.
+     * @param trafficCamera Traffic is spawned and cleaned up around it, after
+     * updating its frustum. No traffic is touched when it is null.
+     * @param timings If not null, the time spent is added to it
+     */
+    void tick(float dt, ViewCamera* trafficCamera,
+              WorldTickTimings* timings = nullptr);
+
     /**
      * Attempt to spawn a vehicle at a vehicle generator
      */
@@ -407,8 +548,48 @@ private:
      */
     std::set<GameObject*> deletionQueue;
 
+    /// Runs the parallel phase of tickObjects() and batched ray tests
+    JobSystem* jobs;
+
+    ObjectGrid dynamicObjectGrid;
+    bool dynamicObjectGridDirty = true;
+
+    /**
+     * Appends objects that may be inside of a box, and some outside of it
+     */
+    void findObjectsNear(const glm::vec3& min, const glm::vec3& max,
+                         uint32_t types, std::vector<GameObject*>& out);
+
+    /// Instances with physics to tick, settled instances are left out
+    std::vector<InstanceObject*> awakeInstances;
+
+    /// Size of the cells that ground heights are cached for
+    static constexpr float kGroundCacheCellSize = 0.25f;
+    /// The cache is cleared when it grows past this many cells
+    static constexpr size_t kMaxGroundCacheSize = 4096;
+
+    static uint64_t getGroundCacheKey(const glm::vec3& position);
+
+    /// Height of the ground in each cell that has been probed
+    std::unordered_map<uint64_t, float> groundHeights;
+
+    /// Scratch space for rayTestStatic()
+    std::vector<btCollisionObject*> rayCandidates;
+    std::vector<size_t> rayCandidateStart;
+
     std::vector<AreaIndicatorInfo> areaIndicators;
 
+    /**
+     * Advances the game clock and the script timer
+     */
+    void updateClocks(float dt);
+
+    /// Game time not yet added to the clock, a game minute lasts a second
+    float clockAccumulator = 0.f;
+    float scriptTimerAccumulator = 0.f;
+    /// Script timer value when the timer last beeped
+    ScriptInt scriptTimerBeepTime = std::numeric_limits<ScriptInt>::max();
+
     /**
      * Flag for pausing the simulation
      */
@@ -0,0 +1,121 @@
+#include "engine/InstanceGrid.hpp"
+
+#include <algorithm>
+
+#include <glm/gtc/quaternion.hpp>
+
+#include "data/CollisionModel.hpp"
+#include "data/ModelData.hpp"
+#include "objects/InstanceObject.hpp"
+#include "render/ViewCamera.hpp"
+
+namespace {
+/// Radius used for models without collision data
+constexpr float kDefaultBoundingRadius = WORLD_CELL_SIZE;
+
+void eraseInstance(std::vector<InstanceObject*>& instances,
+                   InstanceObject* instance) {
+    instances.erase(std::remove(instances.begin(), instances.end(), instance),
+                    instances.end());
+}
+}  // namespace
+
+void InstanceGrid::insert(InstanceObject* instance) {
+    if (instance->dynamics) {
+        dynamicInstances.push_back(instance);
+        return;
+    }
+
+    const auto index = getCellIndex(instance->getPosition());
+    auto& cell = cells[index];
+    cell.instances.push_back(instance);
+    cellIndices[instance] = index;
+    grow(cell, instance);
+}
+
+void InstanceGrid::remove(InstanceObject* instance) {
+    const auto it = cellIndices.find(instance);
+    if (it == cellIndices.end()) {
+        eraseInstance(dynamicInstances, instance);
+        return;
+    }
+
+    // The bounds are left as they are, they only need to be large enough
+    eraseInstance(cells[it->second].instances, instance);
+    cellIndices.erase(it);
+}
+
+void InstanceGrid::update(InstanceObject* instance) {
+    const auto it = cellIndices.find(instance);
+    if (it != cellIndices.end()) {
+        grow(cells[it->second], instance);
+    }
+}
+
+void InstanceGrid::clear() {
+    for (auto& cell : cells) {
+        cell = Cell();
+    }
+    cellIndices.clear();
+    dynamicInstances.clear();
+}
+
+void InstanceGrid::findVisible(const ViewCamera& camera, float distanceFactor,
+                               std::vector<GameObject*>& out) const {
+    for (const auto& cell : cells) {
+        if (cell.instances.empty()) {
+            continue;
+        }
+
+        const auto closest =
+            glm::clamp(camera.position, cell.positionMin, cell.positionMax);
+        if (glm::length(closest - camera.position) / distanceFactor >
+            cell.drawDistance) {
+            continue;
+        }
+
+        const auto center = (cell.boundsMin + cell.boundsMax) * 0.5f;
+        const auto radius = glm::length(cell.boundsMax - center);
+        if (!camera.frustum.intersects(center, radius)) {
+            continue;
+        }
+
+        out.insert(out.end(), cell.instances.begin(), cell.instances.end());
+    }
+
+    out.insert(out.end(), dynamicInstances.begin(), dynamicInstances.end());
+}
+
+size_t InstanceGrid::getCellIndex(const glm::vec3& position) {
+    // Positions outside of the grid go in the cells along its edge
+    const auto lowerCoord = -(WORLD_GRID_SIZE) / 2.f;
+    const auto coord = glm::clamp(
+        glm::ivec2(glm::floor((glm::vec2(position) - glm::vec2(lowerCoord)) /
+                              glm::vec2(WORLD_CELL_SIZE))),
+        glm::ivec2(0), glm::ivec2(WORLD_GRID_WIDTH - 1));
+    return static_cast<size_t>(coord.x * WORLD_GRID_WIDTH + coord.y);
+}
+
+void InstanceGrid::grow(Cell& cell, InstanceObject* instance) {
+    const auto& position = instance->getPosition();
+    auto center = position;
+    auto radius = kDefaultBoundingRadius;
+
+    const auto modelinfo = instance->getModelInfo<SimpleModelInfo>();
+    if (modelinfo) {
+        if (const auto collision = modelinfo->getCollision()) {
+            const auto& sphere = collision->boundingSphere;
+            const auto scale = std::max(
+                {instance->scale.x, instance->scale.y, instance->scale.z});
+            center += instance->getRotation() * (sphere.center * scale);
+            radius = sphere.radius * scale;
+        }
+        cell.drawDistance =
+            std::max(cell.drawDistance, modelinfo->getLargestLodDistance());
+    }
+
+    cell.positionMin = glm::min(cell.positionMin, position);
+    cell.positionMax = glm::max(cell.positionMax, position);
+    cell.boundsMin = glm::min(cell.boundsMin, center - glm::vec3(radius));
+    cell.boundsMax = glm::max(cell.boundsMax, center + glm::vec3(radius));
+}
@@ -0,0 +1,81 @@
+#ifndef _RWENGINE_INSTANCEGRID_HPP_
+#define _RWENGINE_INSTANCEGRID_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <rw/types.hpp>
+
+class GameObject;
+class InstanceObject;
+class ViewCamera;
+
+/**
+ * @brief Spatial index of the instances in the world, used for culling
+ *
+ * Instances without dynamics are bucketed by world grid cell. Each cell keeps
+ * the bounds and largest draw distance of its instances, so cells that are
+ * out of view or too far away are skipped without looking at the instances.
+ * Instances with dynamics can move anywhere and are always returned.
+ */
+class InstanceGrid {
+public:
+    struct Cell {
+        std::vector<InstanceObject*> instances;
+        /// Bounds of the instance positions, which draw distances start from
+        glm::vec3 positionMin{std::numeric_limits<float>::max()};
+        glm::vec3 positionMax{std::numeric_limits<float>::lowest()};
+        /// Bounds of the instance bounding spheres
+        glm::vec3 boundsMin{std::numeric_limits<float>::max()};
+        glm::vec3 boundsMax{std::numeric_limits<float>::lowest()};
+        /// Largest LOD distance of the instances
+        float drawDistance = 0.f;
+    };
+
+    void insert(InstanceObject* instance);
+
+    void remove(InstanceObject* instance);
+
+    /**
+     * @brief update Grows the bounds of an instance's cell after it moved
+     */
+    void update(InstanceObject* instance);
+
+    void clear();
+
+    /**
+     * @brief findVisible Collects instances that could be seen by the camera
+     *
+     * Appends every instance of each cell that passes the draw distance and
+     * frustum tests, followed by the dynamic instances. Instances still need
+     * to be culled individually.
+     *
+     * @param distanceFactor divides the distance to a cell before it is
+     * compared with the draw distance
+     */
+    void findVisible(const ViewCamera& camera, float distanceFactor,
+                     std::vector<GameObject*>& out) const;
+
+    static size_t getCellIndex(const glm::vec3& position);
+
+    const Cell& getCell(size_t index) const {
+        return cells[index];
+    }
+
+    size_t getIndexedCount() const {
+        return cellIndices.size();
+    }
+
+private:
+    void grow(Cell& cell, InstanceObject* instance);
+
+    std::vector<Cell> cells = std::vector<Cell>(WORLD_GRID_CELLS);
+    std::unordered_map<InstanceObject*, size_t> cellIndices;
+    std::vector<InstanceObject*> dynamicInstances;
+};
+
+#endif
@@ -0,0 +1,158 @@
+#include "engine/ModelStreamer.hpp"
+
+#include <exception>
+#include <utility>
+
+#include <platform/FileIndex.hpp>
+#include <rw/debug.hpp>
+
+#include "core/Profiler.hpp"
+
+namespace {
+constexpr size_t kPageSize = 4096;
+
+/// Reads one byte from each page so the page faults happen on the worker
+void touchPages(const FileContentsInfo& file) {
+    volatile char sink = 0;
+    for (size_t offset = 0; offset < file.length; offset += kPageSize) {
+        sink = file.data[offset];
+    }
+    RW_UNUSED(sink);
+}
+}  // namespace
+
+ModelStreamer::ModelStreamer(const FileIndex& index, unsigned int numWorkers)
+    : index_(index) {
+    for (unsigned int i = 0; i < numWorkers; ++i) {
+        workers_.emplace_back([this] { run(); });
+    }
+}
+
+ModelStreamer::~ModelStreamer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    condition_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ModelStreamer::request(const Request& request) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto queued = queued_.find(request.id);
+        if (queued != queued_.end()) {
+            if (request.priority <= queued->second.priority) {
+                return;
+            }
+            queued->second = request;
+        } else if (!requested_.insert(request.id).second) {
+            // Already being read, or waiting to be collected
+            return;
+        } else {
+            queued_.emplace(request.id, request);
+        }
+        queue_.push({request, sequence_++});
+    }
+    condition_.notify_one();
+}
+
+bool ModelStreamer::raisePriority(ModelID id, int priority) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto queued = queued_.find(id);
+    if (queued == queued_.end()) {
+        return false;
+    }
+    if (priority > queued->second.priority) {
+        queued->second.priority = priority;
+        queue_.push({queued->second, sequence_++});
+    }
+    return true;
+}
+
+bool ModelStreamer::isRequested(ModelID id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return requested_.find(id) != requested_.end();
+}
+
+std::optional<ModelStreamer::Result> ModelStreamer::collect() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (completed_.empty()) {
+        return std::nullopt;
+    }
+    std::optional<Result> result(std::move(completed_.front()));
+    completed_.pop_front();
+    requested_.erase(result->request.id);
+    return result;
+}
+
+void ModelStreamer::run() {
+    RW_PROFILE_THREAD("Streaming");
+
+    for (;;) {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock,
+                            [this] { return stopping_ || !queue_.empty(); });
+            if (stopping_) {
+                return;
+            }
+
+            auto entry = queue_.top();
+            queue_.pop();
+
+            // Skip entries that were superseded by a higher priority
+            auto queued = queued_.find(entry.request.id);
+            if (queued == queued_.end() ||
+                queued->second.priority != entry.request.priority) {
+                continue;
+            }
+            request = std::move(queued->second);
+            queued_.erase(queued);
+        }
+
+        RW_PROFILE_SCOPE("Read Model");
+        Result result{request, readFile(request.modelName + ".dff"), {}};
+        if (request.readTextures) {
+            result.textures = readTextures(request.textureSlot + ".txd");
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            completed_.push_back(std::move(result));
+        }
+    }
+}
+
+std::optional<FileContentsInfo> ModelStreamer::readFile(
+    const std::string& name) const {
+    try {
+        auto file = index_.openFile(name);
+        if (!file.data) {
+            return std::nullopt;
+        }
+        touchPages(file);
+        return std::optional<FileContentsInfo>(std::move(file));
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+std::optional<std::vector<DecodedTexture>> ModelStreamer::readTextures(
+    const std::string& name) const {
+    auto file = readFile(name);
+    if (!file) {
+        return std::nullopt;
+    }
+
+    RW_PROFILE_SCOPE("Decode Textures");
+    std::vector<DecodedTexture> textures;
+    TextureLoader loader;
+    if (!loader.decodeFromMemory(*file, textures)) {
+        return std::nullopt;
+    }
+    return std::optional<std::vector<DecodedTexture>>(std::move(textures));
+}
@@ -0,0 +1,122 @@
+#ifndef _RWENGINE_MODELSTREAMER_HPP_
+#define _RWENGINE_MODELSTREAMER_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <loaders/LoaderTXD.hpp>
+#include <platform/FileHandle.hpp>
+
+#include <data/ModelData.hpp>
+
+class FileIndex;
+
+/**
+ * @brief Reads model and texture files on background threads.
+ *
+ * Requests are served highest priority first. The workers read the files,
+ * fault their pages in and decode the textures, the results are turned into
+ * models and uploaded by GameData::updateStreaming() on the thread that owns
+ * the GL context.
+ */
+class ModelStreamer {
+public:
+    struct Request {
+        ModelID id = 0;
+        /// Higher priority requests are read first
+        int priority = 0;
+        /// Name of the model file, without extension
+        std::string modelName;
+        /// Name of the texture slot used by the model
+        std::string textureSlot;
+        /// Whether the texture slot needs to be read as well
+        bool readTextures = false;
+    };
+
+    struct Result {
+        Request request;
+        std::optional<FileContentsInfo> model;
+        /// The decoded texture slot, if it was requested and could be read
+        std::optional<std::vector<DecodedTexture>> textures;
+    };
+
+    ModelStreamer(const FileIndex& index, unsigned int numWorkers);
+    ~ModelStreamer();
+
+    ModelStreamer(const ModelStreamer&) = delete;
+    ModelStreamer& operator=(const ModelStreamer&) = delete;
+
+    /**
+     * @brief request Queues a model to be read.
+     *
+     * Requesting a model that is already queued raises its priority instead.
+     */
+    void request(const Request& request);
+
+    /**
+     * @brief raisePriority Raises the priority of a queued model
+     * @return false if the model isn't waiting in the queue
+     */
+    bool raisePriority(ModelID id, int priority);
+
+    /**
+     * @return true if the model is queued, being read, or waiting to be
+     * collected
+     */
+    bool isRequested(ModelID id) const;
+
+    /**
+     * @brief collect Takes the oldest completed result
+     * @return the result, or nothing if no reads have completed
+     */
+    std::optional<Result> collect();
+
+private:
+    struct Entry {
+        Request request;
+        uint64_t sequence;
+
+        bool operator<(const Entry& other) const {
+            // Higher priority first, then first come first served
+            if (request.priority != other.request.priority) {
+                return request.priority < other.request.priority;
+            }
+            return sequence > other.sequence;
+        }
+    };
+
+    void run();
+
+    std::optional<FileContentsInfo> readFile(const std::string& name) const;
+
+    std::optional<std::vector<DecodedTexture>> readTextures(
+        const std::string& name) const;
+
+    const FileIndex& index_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stopping_ = false;
+    uint64_t sequence_ = 0;
+
+    /// Queue entries, may contain stale entries for re-prioritised requests
+    std::priority_queue<Entry> queue_;
+    /// The current request for each model waiting in the queue
+    std::unordered_map<ModelID, Request> queued_;
+    /// Every model that has been requested but not collected
+    std::unordered_set<ModelID> requested_;
+    std::deque<Result> completed_;
+
+    std::vector<std::thread> workers_;
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include "engine/ObjectGrid.hpp"
+
+#include <algorithm>
+
+ObjectGrid::ObjectGrid(float cellSize)
+    : cellSize(cellSize), bucketStart(kBucketCount + 1, 0) {
+}
+
+void ObjectGrid::clear() {
+    entries.clear();
+    std::fill(bucketStart.begin(), bucketStart.end(), 0);
+}
+
+void ObjectGrid::insert(GameObject* object, const glm::vec3& position) {
+    entries.push_back({position, object});
+}
+
+void ObjectGrid::build() {
+    // Counting sort by bucket
+    std::fill(bucketStart.begin(), bucketStart.end(), 0);
+    entryBuckets.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const auto& position = entries[i].position;
+        entryBuckets[i] =
+            getBucket(getCellCoord(position.x), getCellCoord(position.y));
+        ++bucketStart[entryBuckets[i] + 1];
+    }
+    for (uint32_t b = 0; b < kBucketCount; ++b) {
+        bucketStart[b + 1] += bucketStart[b];
+    }
+
+    sorted.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        sorted[bucketStart[entryBuckets[i]]++] = entries[i];
+    }
+
+    // Filling the buckets moved each start to the next bucket's start
+    for (uint32_t b = kBucketCount; b > 0; --b) {
+        bucketStart[b] = bucketStart[b - 1];
+    }
+    bucketStart[0] = 0;
+
+    entries.swap(sorted);
+}
+
+void ObjectGrid::findWithin(const glm::vec3& position, float radius,
+                            std::vector<GameObject*>& out) const {
+    const auto radius2 = radius * radius;
+    forEachNear(position, radius, [&](const Entry& entry) {
+        if (glm::distance2(position, entry.position) <= radius2) {
+            out.push_back(entry.object);
+        }
+        return false;
+    });
+}
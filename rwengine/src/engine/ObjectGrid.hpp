@@ -0,0 +1,156 @@
+#ifndef _RWENGINE_OBJECTGRID_HPP_
+#define _RWENGINE_OBJECTGRID_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtx/norm.hpp>
+
+class GameObject;
+
+/**
+ * @brief Uniform grid of object positions for proximity queries
+ *
+ * Objects are added with insert() and become visible to queries after
+ * build(). The grid is meant to be rebuilt from scratch whenever the objects
+ * move, which only sorts the objects and doesn't allocate once the storage
+ * has grown.
+ *
+ * Cells are square in x and y, and are hashed into a fixed number of buckets
+ * so the grid can cover any position. Objects from different cells can share
+ * a bucket, queries always compare the actual positions.
+ */
+class ObjectGrid {
+public:
+    struct Entry {
+        glm::vec3 position;
+        GameObject* object;
+    };
+
+    explicit ObjectGrid(float cellSize = 20.f);
+
+    /**
+     * @brief clear Removes every object, build() must be called before the
+     * next query
+     */
+    void clear();
+
+    void insert(GameObject* object, const glm::vec3& position);
+
+    /**
+     * @brief build Sorts the inserted objects by cell so they can be queried
+     */
+    void build();
+
+    /**
+     * @brief forEachNear Calls function(entry) for the objects in the cells
+     * that overlap a sphere, including some outside of it
+     *
+     * The function returns true to stop the search.
+     * @return true if the search was stopped
+     */
+    template <class Function>
+    bool forEachNear(const glm::vec3& position, float radius,
+                     Function function) const;
+
+    /**
+     * @return true if an object is no further than radius from position
+     */
+    bool isAnyWithin(const glm::vec3& position, float radius) const {
+        const auto radius2 = radius * radius;
+        return forEachNear(position, radius, [&](const Entry& entry) {
+            return glm::distance2(position, entry.position) <= radius2;
+        });
+    }
+
+    /**
+     * @brief findWithin Appends the objects no further than radius from
+     * position to out
+     */
+    void findWithin(const glm::vec3& position, float radius,
+                    std::vector<GameObject*>& out) const;
+
+    size_t size() const {
+        return entries.size();
+    }
+
+    float getCellSize() const {
+        return cellSize;
+    }
+
+private:
+    static constexpr uint32_t kBucketCount = 1024;
+    /// Queries with a larger radius, in cells, check every object
+    static constexpr uint32_t kMaxSearchRadius = 7;
+
+    int32_t getCellCoord(float position) const {
+        return static_cast<int32_t>(std::floor(position / cellSize));
+    }
+
+    static uint32_t getBucket(int32_t x, int32_t y) {
+        const auto hash = static_cast<uint32_t>(x) * 73856093u ^
+                          static_cast<uint32_t>(y) * 19349663u;
+        return hash & (kBucketCount - 1);
+    }
+
+    float cellSize;
+
+    /// Inserted objects, sorted by bucket after build()
+    std::vector<Entry> entries;
+    /// Entries in bucket b are [bucketStart[b], bucketStart[b + 1])
+    std::vector<uint32_t> bucketStart;
+
+    /// Scratch space for build()
+    std::vector<uint32_t> entryBuckets;
+    std::vector<Entry> sorted;
+};
+
+template <class Function>
+bool ObjectGrid::forEachNear(const glm::vec3& position, float radius,
+                             Function function) const {
+    // Large areas cover most of the buckets anyway
+    if (!(radius < cellSize * kMaxSearchRadius)) {
+        for (const auto& entry : entries) {
+            if (function(entry)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const auto minX = getCellCoord(position.x - radius);
+    const auto maxX = getCellCoord(position.x + radius);
+    const auto minY = getCellCoord(position.y - radius);
+    const auto maxY = getCellCoord(position.y + radius);
+
+    // Each bucket is only visited once, even if several cells hash to it
+    constexpr auto kMaxWidth = kMaxSearchRadius * 2 + 2;
+    uint32_t visited[kMaxWidth * kMaxWidth];
+    size_t visitedCount = 0;
+    for (auto x = minX; x <= maxX; ++x) {
+        for (auto y = minY; y <= maxY; ++y) {
+            const auto bucket = getBucket(x, y);
+            bool seen = false;
+            for (size_t i = 0; i < visitedCount; ++i) {
+                seen = seen || visited[i] == bucket;
+            }
+            if (seen) {
+                continue;
+            }
+            visited[visitedCount++] = bucket;
+
+            for (auto e = bucketStart[bucket]; e < bucketStart[bucket + 1];
+                 ++e) {
+                if (function(entries[e])) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+#endif
@@ -0,0 +1,102 @@
+#include "engine/ObjectPool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include <rw/debug.hpp>
+
+#include "objects/GameObject.hpp"
+
+// Slot 0 is reserved so that no object has the ID 0
+ObjectPool::ObjectPool() : slots(1) {
+}
+
+ObjectPool::~ObjectPool() = default;
+
+uint32_t ObjectPool::allocateSlot(GameObjectID requested) {
+    const auto index = getIndex(requested);
+    if (index != 0) {
+        if (index >= slots.size()) {
+            for (auto i = index - 1; i >= slots.size(); --i) {
+                freeSlots.push_back(i);
+            }
+            slots.resize(index + 1);
+            slots[index].generation = getGeneration(requested);
+            return index;
+        }
+
+        auto it = std::find(freeSlots.begin(), freeSlots.end(), index);
+        if (it != freeSlots.end()) {
+            freeSlots.erase(it);
+            slots[index].generation = getGeneration(requested);
+            return index;
+        }
+
+        RW_MESSAGE("GameObjectID " << requested
+                                   << " is in use, allocating another");
+    }
+
+    if (!freeSlots.empty()) {
+        const auto index = freeSlots.back();
+        freeSlots.pop_back();
+        return index;
+    }
+
+    RW_CHECK(slots.size() <= kIndexMask, "Object pool is full");
+    slots.emplace_back();
+    return static_cast<uint32_t>(slots.size() - 1);
+}
+
+void ObjectPool::insert(std::unique_ptr<GameObject> object) {
+    const auto index = allocateSlot(object->getGameObjectID());
+    auto& slot = slots[index];
+    object->setGameObjectID(makeID(index, slot.generation));
+
+    slot.denseIndex = static_cast<uint32_t>(dense.size());
+    dense.push_back(object.get());
+    denseSlots.push_back(index);
+    slot.object = std::move(object);
+}
+
+void ObjectPool::remove(GameObject* object) {
+    if (!object || find(object->getGameObjectID()) != object) {
+        return;
+    }
+
+    const auto index = getIndex(object->getGameObjectID());
+    auto& slot = slots[index];
+
+    // Move the last object into the gap
+    const auto denseIndex = slot.denseIndex;
+    dense[denseIndex] = dense.back();
+    denseSlots[denseIndex] = denseSlots.back();
+    slots[denseSlots[denseIndex]].denseIndex = denseIndex;
+    dense.pop_back();
+    denseSlots.pop_back();
+
+    // The object may use the pool while it is destroyed, so finish first
+    auto owned = std::move(slot.object);
+    slot.generation = (slot.generation + 1) & kGenerationMask;
+    freeSlots.push_back(index);
+    owned.reset();
+}
+
+void ObjectPool::clear() {
+    std::vector<std::unique_ptr<GameObject>> owned;
+    owned.reserve(dense.size());
+    dense.clear();
+    denseSlots.clear();
+
+    // Free the lowest slots last so they are reused first
+    freeSlots.clear();
+    for (auto i = static_cast<uint32_t>(slots.size()) - 1; i > 0; --i) {
+        auto& slot = slots[i];
+        if (slot.object) {
+            owned.push_back(std::move(slot.object));
+            slot.generation = (slot.generation + 1) & kGenerationMask;
+        }
+        freeSlots.push_back(i);
+    }
+
+    owned.clear();
+}
@@ -0,0 +1,159 @@
+#ifndef _RWENGINE_OBJECTPOOL_HPP_
+#define _RWENGINE_OBJECTPOOL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <objects/ObjectTypes.hpp>
+
+class GameObject;
+
+/**
+ * @class ObjectPool
+ *  Owns game objects of one type and hands out their GameObjectIDs
+ *
+ * Each object lives in a slot, its GameObjectID holds the slot index and the
+ * slot's generation. The generation changes whenever the slot is freed, so
+ * IDs of destroyed objects, such as stale script handles, don't find
+ * whichever object takes the slot next. Slot 0 is never used, so 0 is never
+ * a valid ID.
+ *
+ * The objects are also kept in a dense array for iteration, removal moves
+ * the last object into the gap so iteration order isn't stable.
+ */
+class ObjectPool {
+public:
+    static constexpr uint32_t kIndexBits = 20;
+    static constexpr uint32_t kIndexMask = (1u << kIndexBits) - 1;
+    /// Keeps IDs positive when scripts store them as signed integers
+    static constexpr uint32_t kGenerationMask = (1u << 11) - 1;
+
+    static GameObjectID makeID(uint32_t index, uint32_t generation) {
+        return ((generation & kGenerationMask) << kIndexBits) | index;
+    }
+
+    static uint32_t getIndex(GameObjectID id) {
+        return id & kIndexMask;
+    }
+
+    static uint32_t getGeneration(GameObjectID id) {
+        return (id >> kIndexBits) & kGenerationMask;
+    }
+
+    ObjectPool();
+    ~ObjectPool();
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    /**
+     * Inserts the object into the pool, allocating it a GameObjectID unless
+     * it already has an ID that is free
+     */
+    void insert(std::unique_ptr<GameObject> object);
+
+    /**
+     * Removes and destroys a game object from this pool
+     */
+    void remove(GameObject* object);
+
+    /**
+     * Finds a game object if it exists in this pool
+     */
+    GameObject* find(GameObjectID id) const {
+        const auto index = getIndex(id);
+        if (index == 0 || index >= slots.size()) {
+            return nullptr;
+        }
+        const auto& slot = slots[index];
+        return slot.generation == getGeneration(id) ? slot.object.get()
+                                                    : nullptr;
+    }
+
+    /**
+     * Removes all stored objects
+     */
+    void clear();
+
+    size_t size() const {
+        return dense.size();
+    }
+
+    bool empty() const {
+        return dense.empty();
+    }
+
+    /**
+     * The objects, in no particular order
+     */
+    const std::vector<GameObject*>& getObjects() const {
+        return dense;
+    }
+
+private:
+    struct Slot {
+        std::unique_ptr<GameObject> object;
+        uint32_t generation = 0;
+        uint32_t denseIndex = 0;
+    };
+
+    uint32_t allocateSlot(GameObjectID requested);
+
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+
+    std::vector<GameObject*> dense;
+    /// The slot of each object in dense
+    std::vector<uint32_t> denseSlots;
+};
+
+/**
+ * @brief ObjectPool of one object class, which can be iterated and searched
+ * without casting
+ */
+template <class T>
+class TypedObjectPool : public ObjectPool {
+public:
+    class iterator {
+    public:
+        explicit iterator(std::vector<GameObject*>::const_iterator it)
+            : it(it) {
+        }
+
+        T* operator*() const {
+            return static_cast<T*>(*it);
+        }
+
+        iterator& operator++() {
+            ++it;
+            return *this;
+        }
+
+        bool operator!=(const iterator& other) const {
+            return it != other.it;
+        }
+
+        bool operator==(const iterator& other) const {
+            return it == other.it;
+        }
+
+    private:
+        std::vector<GameObject*>::const_iterator it;
+    };
+
+    T* find(GameObjectID id) const {
+        return static_cast<T*>(ObjectPool::find(id));
+    }
+
+    iterator begin() const {
+        return iterator(getObjects().begin());
+    }
+
+    iterator end() const {
+        return iterator(getObjects().end());
+    }
+};
+
+#endif
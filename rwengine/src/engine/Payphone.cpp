@@ -14,16 +14,15 @@
 Payphone::Payphone(GameWorld* engine_, size_t id_, const glm::vec2& coord)
     : engine(engine_), id(id_) {
     // Find payphone object, original game does this differently
-    for (const auto& p : engine->instancePool.objects) {
-        auto o = p.second.get();
-        if (!o->getModel()) {
+    for (const auto o : engine->instancePool) {
+        if (!o->getModelInfo<BaseModelInfo>()) {
             continue;
         }
         if (o->getModelInfo<BaseModelInfo>()->name != "phonebooth1") {
             continue;
         }
         if (glm::distance(coord, glm::vec2(o->getPosition())) < 2.f) {
-            object = static_cast<InstanceObject*>(o);
+            object = o;
             break;
         }
     }
@@ -39,9 +39,6 @@ void Weapon::fireProjectile(WeaponData* weapon, CharacterObject* owner,
             pt, direction,
             17.f * force,  /// @todo pull a better velocity from somewhere
             3.5f, weapon});
-    auto ptr = projectile.get();
 
-    auto& pool = owner->engine->getTypeObjectPool(ptr);
-    pool.insert(std::move(projectile));
-    owner->engine->allObjects.push_back(ptr);
+    owner->engine->insertObject(std::move(projectile));
 }
@@ -0,0 +1,327 @@
+#include "loaders/AssetCache.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include <utility>
+
+#include <glm/glm.hpp>
+
+#include <platform/MappedFile.hpp>
+
+#include "data/CollisionModel.hpp"
+#include "loaders/LoaderIFP.hpp"
+
+namespace {
+constexpr char kMagic[4] = {'R', 'W', 'B', 'K'};
+
+enum class BakedKind : uint32_t { Collisions = 1, Animations = 2 };
+
+struct BakedHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t kind;
+    uint32_t count;
+    uint64_t sourceHash;
+};
+
+// Arrays of these are copied in and out of the cache as-is
+static_assert(std::is_trivially_copyable<CollisionModel::Sphere>::value &&
+                  sizeof(CollisionModel::Sphere) == 20,
+              "CollisionModel::Sphere must be packed");
+static_assert(std::is_trivially_copyable<CollisionModel::Box>::value &&
+                  sizeof(CollisionModel::Box) == 28,
+              "CollisionModel::Box must be packed");
+static_assert(std::is_trivially_copyable<CollisionModel::Triangle>::value &&
+                  sizeof(CollisionModel::Triangle) == 16,
+              "CollisionModel::Triangle must be packed");
+static_assert(sizeof(glm::vec3) == 12, "glm::vec3 must be packed");
+static_assert(sizeof(glm::quat) == 16, "glm::quat must be packed");
+
+class BakedWriter {
+public:
+    template <class T>
+    void write(const T& value) {
+        const auto bytes = reinterpret_cast<const char*>(&value);
+        data.insert(data.end(), bytes, bytes + sizeof(T));
+    }
+
+    template <class T>
+    void writeArray(const std::vector<T>& values) {
+        write(static_cast<uint32_t>(values.size()));
+        const auto bytes = reinterpret_cast<const char*>(values.data());
+        data.insert(data.end(), bytes, bytes + values.size() * sizeof(T));
+    }
+
+    void writeString(const std::string& string) {
+        write(static_cast<uint32_t>(string.size()));
+        data.insert(data.end(), string.begin(), string.end());
+    }
+
+    std::vector<char> data;
+};
+
+class BakedReader {
+public:
+    BakedReader(const char* data, size_t length)
+        : cursor(data), end(data + length) {
+    }
+
+    template <class T>
+    bool read(T& value) {
+        if (remaining() < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return true;
+    }
+
+    template <class T>
+    bool readArray(std::vector<T>& values) {
+        uint32_t count = 0;
+        if (!read(count) || remaining() / sizeof(T) < count) {
+            return false;
+        }
+        values.resize(count);
+        std::memcpy(values.data(), cursor, count * sizeof(T));
+        cursor += count * sizeof(T);
+        return true;
+    }
+
+    bool readString(std::string& string) {
+        uint32_t length = 0;
+        if (!read(length) || remaining() < length) {
+            return false;
+        }
+        string.assign(cursor, length);
+        cursor += length;
+        return true;
+    }
+
+private:
+    size_t remaining() const {
+        return static_cast<size_t>(end - cursor);
+    }
+
+    const char* cursor;
+    const char* end;
+};
+
+void writeHeader(BakedWriter& writer, BakedKind kind, size_t count,
+                 uint64_t sourceHash) {
+    BakedHeader header{};
+    std::copy(std::begin(kMagic), std::end(kMagic), header.magic);
+    header.version = AssetCache::kVersion;
+    header.kind = static_cast<uint32_t>(kind);
+    header.count = static_cast<uint32_t>(count);
+    header.sourceHash = sourceHash;
+    writer.write(header);
+}
+
+bool readHeader(BakedReader& reader, BakedKind kind, uint64_t sourceHash,
+                uint32_t& count) {
+    BakedHeader header;
+    if (!reader.read(header)) {
+        return false;
+    }
+    if (!std::equal(std::begin(kMagic), std::end(kMagic), header.magic) ||
+        header.version != AssetCache::kVersion ||
+        header.kind != static_cast<uint32_t>(kind) ||
+        header.sourceHash != sourceHash) {
+        return false;
+    }
+    count = header.count;
+    return true;
+}
+}  // namespace
+
+AssetCache::AssetCache(const rwfs::path& directory) : directory(directory) {
+}
+
+uint64_t AssetCache::hashContents(const char* data, size_t length) {
+    // 64 bit FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+rwfs::path AssetCache::getBakedPath(const std::string& name) const {
+    auto filename = name.substr(name.find_last_of("/\\") + 1);
+    std::transform(filename.begin(), filename.end(), filename.begin(),
+                   ::tolower);
+    return directory / (filename + ".bake");
+}
+
+bool AssetCache::loadCollisions(
+    const std::string& name, uint64_t sourceHash,
+    std::vector<std::unique_ptr<CollisionModel>>& collisions) const {
+    if (!isEnabled()) {
+        return false;
+    }
+    auto file = MappedFile::open(getBakedPath(name));
+    if (!file) {
+        return false;
+    }
+
+    BakedReader reader(file->data(), file->size());
+    uint32_t count = 0;
+    if (!readHeader(reader, BakedKind::Collisions, sourceHash, count)) {
+        return false;
+    }
+
+    std::vector<std::unique_ptr<CollisionModel>> models;
+    models.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        auto model = std::make_unique<CollisionModel>();
+        if (!reader.readString(model->name) || !reader.read(model->modelid) ||
+            !reader.read(model->boundingSphere) ||
+            !reader.read(model->boundingBox) ||
+            !reader.readArray(model->spheres) ||
+            !reader.readArray(model->boxes) ||
+            !reader.readArray(model->vertices) ||
+            !reader.readArray(model->faces)) {
+            return false;
+        }
+        models.emplace_back(std::move(model));
+    }
+
+    collisions = std::move(models);
+    return true;
+}
+
+bool AssetCache::bakeCollisions(
+    const std::string& name, uint64_t sourceHash,
+    const std::vector<std::unique_ptr<CollisionModel>>& collisions) const {
+    if (!isEnabled()) {
+        return false;
+    }
+
+    BakedWriter writer;
+    writeHeader(writer, BakedKind::Collisions, collisions.size(), sourceHash);
+    for (const auto& model : collisions) {
+        writer.writeString(model->name);
+        writer.write(model->modelid);
+        writer.write(model->boundingSphere);
+        writer.write(model->boundingBox);
+        writer.writeArray(model->spheres);
+        writer.writeArray(model->boxes);
+        writer.writeArray(model->vertices);
+        writer.writeArray(model->faces);
+    }
+
+    return write(name, writer.data);
+}
+
+bool AssetCache::loadAnimations(const std::string& name, uint64_t sourceHash,
+                                AnimationSet& animations) const {
+    if (!isEnabled()) {
+        return false;
+    }
+    auto file = MappedFile::open(getBakedPath(name));
+    if (!file) {
+        return false;
+    }
+
+    BakedReader reader(file->data(), file->size());
+    uint32_t count = 0;
+    if (!readHeader(reader, BakedKind::Animations, sourceHash, count)) {
+        return false;
+    }
+
+    AnimationSet loaded;
+    for (uint32_t i = 0; i < count; ++i) {
+        std::string key;
+        auto animation = std::make_shared<Animation>();
+        uint32_t numBones = 0;
+        if (!reader.readString(key) || !reader.readString(animation->name) ||
+            !reader.read(animation->duration) || !reader.read(numBones)) {
+            return false;
+        }
+
+        for (uint32_t b = 0; b < numBones; ++b) {
+            std::string boneKey;
+            auto bone = std::make_unique<AnimationBone>();
+            uint32_t type = 0;
+            if (!reader.readString(boneKey) || !reader.readString(bone->name) ||
+                !reader.read(bone->duration) || !reader.read(type) ||
+                !reader.readArray(bone->times) ||
+                !reader.readArray(bone->rotations) ||
+                !reader.readArray(bone->positions) ||
+                !reader.readArray(bone->scales)) {
+                return false;
+            }
+            const auto keyframes = bone->getKeyframeCount();
+            if (bone->rotations.size() != keyframes ||
+                bone->positions.size() != keyframes ||
+                bone->scales.size() != keyframes) {
+                return false;
+            }
+            bone->type = static_cast<AnimationBone::Data>(type);
+            animation->bones.emplace(boneKey, std::move(bone));
+        }
+
+        loaded.emplace(key, std::move(animation));
+    }
+
+    animations.insert(loaded.begin(), loaded.end());
+    return true;
+}
+
+bool AssetCache::bakeAnimations(const std::string& name, uint64_t sourceHash,
+                                const AnimationSet& animations) const {
+    if (!isEnabled()) {
+        return false;
+    }
+
+    BakedWriter writer;
+    writeHeader(writer, BakedKind::Animations, animations.size(), sourceHash);
+    for (const auto& animation : animations) {
+        writer.writeString(animation.first);
+        writer.writeString(animation.second->name);
+        writer.write(animation.second->duration);
+        writer.write(static_cast<uint32_t>(animation.second->bones.size()));
+
+        for (const auto& bone : animation.second->bones) {
+            writer.writeString(bone.first);
+            writer.writeString(bone.second->name);
+            writer.write(bone.second->duration);
+            writer.write(static_cast<uint32_t>(bone.second->type));
+            writer.writeArray(bone.second->times);
+            writer.writeArray(bone.second->rotations);
+            writer.writeArray(bone.second->positions);
+            writer.writeArray(bone.second->scales);
+        }
+    }
+
+    return write(name, writer.data);
+}
+
+bool AssetCache::write(const std::string& name,
+                       const std::vector<char>& data) const {
+    rwfs::error_code ec;
+    rwfs::create_directories(directory, ec);
+
+    // Write to a temporary file so a partial entry is never loaded
+    const auto path = getBakedPath(name);
+    auto temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream file(temporary.string(), std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+        if (!file) {
+            return false;
+        }
+    }
+
+    rwfs::rename(temporary, path, ec);
+    return !ec;
+}
@@ -0,0 +1,84 @@
+#ifndef _RWENGINE_ASSETCACHE_HPP_
+#define _RWENGINE_ASSETCACHE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <rw/filesystem.hpp>
+#include <rw/forward.hpp>
+
+struct CollisionModel;
+
+/**
+ * @class AssetCache
+ *  Stores parsed collision and animation data in a flat binary format
+ *
+ * Each source file is baked into its own file in the cache directory, which
+ * is mapped and copied straight into the runtime structures when loading.
+ * A baked file records the format version and a hash of the source file it
+ * was made from, entries that don't match are treated as missing so they
+ * can be baked again.
+ */
+class AssetCache {
+public:
+    /// Increased whenever the baked layout changes
+    static constexpr uint32_t kVersion = 2;
+
+    /// Creates a disabled cache
+    AssetCache() = default;
+
+    explicit AssetCache(const rwfs::path& directory);
+
+    bool isEnabled() const {
+        return !directory.empty();
+    }
+
+    const rwfs::path& getDirectory() const {
+        return directory;
+    }
+
+    /**
+     * Hashes the contents of a source file, the hash is used to detect
+     * stale entries.
+     */
+    static uint64_t hashContents(const char* data, size_t length);
+
+    /**
+     * Returns the path of the baked file for a source file, baked files are
+     * named after the source file so the same entry is found wherever the
+     * source is loaded from.
+     */
+    rwfs::path getBakedPath(const std::string& name) const;
+
+    /**
+     * Loads baked collision models.
+     * @return false if there is no current entry for the source
+     */
+    bool loadCollisions(
+        const std::string& name, uint64_t sourceHash,
+        std::vector<std::unique_ptr<CollisionModel>>& collisions) const;
+
+    bool bakeCollisions(
+        const std::string& name, uint64_t sourceHash,
+        const std::vector<std::unique_ptr<CollisionModel>>& collisions) const;
+
+    /**
+     * Loads baked animations.
+     * @return false if there is no current entry for the source
+     */
+    bool loadAnimations(const std::string& name, uint64_t sourceHash,
+                        AnimationSet& animations) const;
+
+    bool bakeAnimations(const std::string& name, uint64_t sourceHash,
+                        const AnimationSet& animations) const;
+
+private:
+    bool write(const std::string& name, const std::vector<char>& data) const;
+
+    rwfs::path directory;
+};
+
+#endif
@@ -3,11 +3,14 @@
 #include <cstdint>
 #include <cstring>
 #include <fstream>
+#include <memory>
 #include <stdexcept>
 #include <string>
 
 #include <glm/glm.hpp>
 
+#include <platform/FileHandle.hpp>
+
 #include "data/CollisionModel.hpp"
 
 constexpr uint32_t kCollMagic = 0x4C4C4F43;
@@ -29,11 +32,18 @@ bool LoaderCOL::load(const std::string& path) {
     size_t length = file.tellg();
     file.seekg(0);
 
-    std::vector<char> buffer(length);
-    auto d = buffer.data();
-    file.read(d, length);
+    auto buffer = std::make_unique<char[]>(length);
+    file.read(buffer.get(), length);
+
+    return loadFromMemory(FileContentsInfo(std::move(buffer), length), path);
+}
+
+bool LoaderCOL::loadFromMemory(const FileContentsInfo& file,
+                               const std::string& path) {
+    auto d = file.data;
+    const auto end = file.data + file.length;
 
-    while (d < buffer.data() + length) {
+    while (d < end) {
         ColHeader head;
         std::memcpy(&head, d, sizeof(head));
         d += sizeof(head);
@@ -1,6 +1,7 @@
 #ifndef _RWENGINE_LOADERCOL_HPP_
 #define _RWENGINE_LOADERCOL_HPP_
 #include <data/CollisionModel.hpp>
+#include <rw/forward.hpp>
 #include <memory>
 #include <string>
 #include <vector>
@@ -14,6 +15,9 @@ public:
     /// Load the COL data into memory
     bool load(const std::string& file);
 
+    /// Load COL data that has already been read, path is used in errors
+    bool loadFromMemory(const FileContentsInfo& file, const std::string& path);
+
     std::vector<std::unique_ptr<CollisionModel>> collisions;
 };
 
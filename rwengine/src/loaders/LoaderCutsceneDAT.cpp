@@ -13,7 +13,7 @@
 #include "platform/FileHandle.hpp"
 
 void LoaderCutsceneDAT::load(CutsceneTracks &tracks, const FileContentsInfo& file) {
-    std::string dataStr(file.data.get(), file.length);
+    std::string dataStr(file.data, file.length);
     std::stringstream ss(dataStr);
 
     int numZooms = 0;
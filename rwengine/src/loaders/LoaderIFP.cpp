@@ -4,56 +4,82 @@
 #include <cctype>
 #include <memory>
 
-bool findKeyframes(float t, AnimationBone* bone, AnimationKeyframe& f1,
-                   AnimationKeyframe& f2, float& alpha) {
-    for (size_t f = 0; f < bone->frames.size(); ++f) {
-        if (t <= bone->frames[f].starttime) {
-            f2 = bone->frames[f];
-
-            if (f == 0) {
-                if (bone->frames.size() != 1) {
-                    f1 = bone->frames.back();
-                } else {
-                    f1 = f2;
-                }
-            } else {
-                f1 = bone->frames[f - 1];
-            }
+void AnimationBone::reserveKeyframes(size_t count) {
+    times.reserve(count);
+    rotations.reserve(count);
+    positions.reserve(count);
+    scales.reserve(count);
+}
 
-            float tdiff = (f2.starttime - f1.starttime);
-            if (tdiff == 0.f) {
-                alpha = 1.f;
-            } else {
-                alpha = glm::clamp((t - f1.starttime) / tdiff, 0.f, 1.f);
-            }
+void AnimationBone::addKeyframe(const glm::quat& rotation,
+                                const glm::vec3& position,
+                                const glm::vec3& scale, float time) {
+    times.push_back(time);
+    rotations.push_back(rotation);
+    positions.push_back(position);
+    scales.push_back(scale);
+}
 
-            return true;
-        }
+bool AnimationBone::findKeyframes(float time, size_t& cursor, size_t& first,
+                                  size_t& second, float& alpha) const {
+    const auto count = times.size();
+
+    // Every keyframe before the cursor must be earlier than time, otherwise
+    // time went backwards (usually a loop) and the search starts again
+    if (cursor > count || (cursor > 0 && time <= times[cursor - 1])) {
+        cursor = 0;
+    }
+    while (cursor < count && time > times[cursor]) {
+        ++cursor;
+    }
+    if (cursor == count) {
+        return false;
     }
-    return false;
+
+    second = cursor;
+    if (cursor == 0) {
+        first = count != 1 ? count - 1 : 0;
+    } else {
+        first = cursor - 1;
+    }
+
+    float tdiff = (times[second] - times[first]);
+    if (tdiff == 0.f) {
+        alpha = 1.f;
+    } else {
+        alpha = glm::clamp((time - times[first]) / tdiff, 0.f, 1.f);
+    }
+
+    return true;
+}
+
+AnimationKeyframe AnimationBone::getInterpolatedKeyframe(float time) const {
+    size_t cursor = 0;
+    return getInterpolatedKeyframe(time, cursor);
 }
 
-AnimationKeyframe AnimationBone::getInterpolatedKeyframe(float time) {
-    AnimationKeyframe f1, f2;
+AnimationKeyframe AnimationBone::getInterpolatedKeyframe(
+    float time, size_t& cursor) const {
+    size_t f1, f2;
     float alpha;
 
-    if (findKeyframes(time, this, f1, f2, alpha)) {
-        return {glm::normalize(glm::slerp(f1.rotation, f2.rotation, alpha)),
-                glm::mix(f1.position, f2.position, alpha),
-                glm::mix(f1.scale, f2.scale, alpha), time,
-                std::max(f1.id, f2.id)};
+    if (findKeyframes(time, cursor, f1, f2, alpha)) {
+        return {glm::normalize(glm::slerp(rotations[f1], rotations[f2], alpha)),
+                glm::mix(positions[f1], positions[f2], alpha),
+                glm::mix(scales[f1], scales[f2], alpha), time,
+                static_cast<int>(std::max(f1, f2))};
     }
 
-    return frames.back();
+    return getFrame(times.size() - 1);
 }
 
-AnimationKeyframe AnimationBone::getKeyframe(float time) {
-    for (auto &frame : frames) {
-        if (time >= frame.starttime) {
-            return frame;
+AnimationKeyframe AnimationBone::getKeyframe(float time) const {
+    for (size_t f = 0; f < times.size(); ++f) {
+        if (time >= times[f]) {
+            return getFrame(f);
         }
     }
-    return frames.back();
+    return getFrame(times.size() - 1);
 }
 
 bool LoaderIFP::loadFromMemory(char* data) {
@@ -83,7 +109,7 @@ bool LoaderIFP::loadFromMemory(char* data) {
 
             auto bonedata = std::make_unique<AnimationBone>();
             bonedata->name = frames->name;
-            bonedata->frames.reserve(frames->frames);
+            bonedata->reserveKeyframes(frames->frames);
 
             data_offs += ((8 + frames->base.size) - sizeof(ANIM));
 
@@ -97,9 +123,8 @@ bool LoaderIFP::loadFromMemory(char* data) {
                 for (int d = 0; d < frames->frames; ++d) {
                     glm::quat q = glm::conjugate(*read<glm::quat>(data, dataI));
                     time = *read<float>(data, dataI);
-                    bonedata->frames.emplace_back(q, glm::vec3(0.f, 0.f, 0.f),
-                                                glm::vec3(1.f, 1.f, 1.f), time,
-                                                d);
+                    bonedata->addKeyframe(q, glm::vec3(0.f, 0.f, 0.f),
+                                          glm::vec3(1.f, 1.f, 1.f), time);
                 }
             } else if (type == "KRT0") {
                 bonedata->type = AnimationBone::RT0;
@@ -107,8 +132,8 @@ bool LoaderIFP::loadFromMemory(char* data) {
                     glm::quat q = glm::conjugate(*read<glm::quat>(data, dataI));
                     glm::vec3 p = *read<glm::vec3>(data, dataI);
                     time = *read<float>(data, dataI);
-                    bonedata->frames.emplace_back(
-                        q, p, glm::vec3(1.f, 1.f, 1.f), time, d);
+                    bonedata->addKeyframe(q, p, glm::vec3(1.f, 1.f, 1.f),
+                                          time);
                 }
             } else if (type == "KRTS") {
                 bonedata->type = AnimationBone::RTS;
@@ -117,7 +142,7 @@ bool LoaderIFP::loadFromMemory(char* data) {
                     glm::vec3 p = *read<glm::vec3>(data, dataI);
                     glm::vec3 s = *read<glm::vec3>(data, dataI);
                     time = *read<float>(data, dataI);
-                    bonedata->frames.emplace_back(q, p, s, time, d);
+                    bonedata->addKeyframe(q, p, s, time);
                 }
             }
 
@@ -39,7 +39,13 @@ struct AnimationBone {
     enum Data { R00, RT0, RTS };
 
     Data type;
-    std::vector<AnimationKeyframe> frames;
+
+    /// Keyframes are stored as one array per component, all the same length,
+    /// so sampling only touches the data it uses
+    std::vector<float> times;
+    std::vector<glm::quat> rotations;
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> scales;
 
     AnimationBone() = default;
 
@@ -50,14 +56,45 @@ struct AnimationBone {
         , previous(p_previous)
         , next(p_next)
         , duration(p_duration)
-        , type(p_type)
-        , frames(p_frames) {
+        , type(p_type) {
+        reserveKeyframes(p_frames.size());
+        for (const auto& frame : p_frames) {
+            addKeyframe(frame.rotation, frame.position, frame.scale,
+                        frame.starttime);
+        }
     }
 
     ~AnimationBone() = default;
 
-    AnimationKeyframe getInterpolatedKeyframe(float time);
-    AnimationKeyframe getKeyframe(float time);
+    size_t getKeyframeCount() const {
+        return times.size();
+    }
+
+    void reserveKeyframes(size_t count);
+
+    void addKeyframe(const glm::quat& rotation, const glm::vec3& position,
+                     const glm::vec3& scale, float time);
+
+    AnimationKeyframe getFrame(size_t index) const {
+        return {rotations[index], positions[index], scales[index],
+                times[index], static_cast<int>(index)};
+    }
+
+    /**
+     * @brief findKeyframes Finds the keyframes to blend between at time
+     * @param cursor Keyframe to start searching from, updated to the
+     * keyframe found. Reusing a cursor as time advances makes each search
+     * O(1) on average
+     * @param alpha Amount of the second keyframe to use
+     * @return false if time is after the last keyframe
+     */
+    bool findKeyframes(float time, size_t& cursor, size_t& first,
+                       size_t& second, float& alpha) const;
+
+    AnimationKeyframe getInterpolatedKeyframe(float time) const;
+    AnimationKeyframe getInterpolatedKeyframe(float time,
+                                              size_t& cursor) const;
+    AnimationKeyframe getKeyframe(float time) const;
 };
 
 /**
@@ -280,6 +280,12 @@ glm::vec3 CharacterObject::updateMovementAnimation(float dt) {
 }
 
 void CharacterObject::tick(float dt) {
+    tickBeforeAnimation(dt);
+    tickAnimation(dt);
+    tickAfterAnimation(dt);
+}
+
+void CharacterObject::tickBeforeAnimation(float dt) {
     if (controller) {
         controller->update(dt);
 
@@ -288,16 +294,40 @@ void CharacterObject::tick(float dt) {
             cycle_ = AnimCycle::Idle;
         }
     }
+}
 
+void CharacterObject::tickAnimation(float dt) {
     animator->tick(dt);
+}
+
+void CharacterObject::tickAfterAnimation(float dt) {
     updateCharacter(dt);
 
+    if (currentVehicle) {
+        updateSeatTransform();
+    }
+
     // Ensure the character doesn't need to be reset
     if (getPosition().z < -100.f) {
         resetToAINode();
     }
 }
 
+void CharacterObject::updateSeatTransform() {
+    const auto& vehicleclump = currentVehicle->getClump();
+    auto matrixModel = vehicleclump->getFrame()->getWorldTransform();
+    if (isEnteringOrExitingVehicle()) {
+        matrixModel = glm::translate(
+            matrixModel, currentVehicle->getSeatEntryPosition(currentSeat));
+    } else if (currentSeat < currentVehicle->info->seats.size()) {
+        matrixModel = glm::translate(
+            matrixModel, currentVehicle->info->seats[currentSeat].offset);
+    } else {
+        return;
+    }
+    getClump()->getFrame()->setTransform(matrixModel);
+}
+
 void CharacterObject::tickPhysics(float dt) {
     if (physCharacter) {
         auto s = currenteMovementStep * dt;
@@ -433,6 +463,7 @@ void CharacterObject::setPosition(const glm::vec3& pos) {
     }
     position = realPos;
     getClump()->getFrame()->setTranslation(pos);
+    engine->markDynamicObjectGridDirty();
 }
 
 glm::vec3 CharacterObject::getCenterOffset() {
@@ -590,23 +621,10 @@ void CharacterObject::setJumpSpeed(float speed) {
 }
 
 void CharacterObject::resetToAINode() {
-    auto& nodes = engine->aigraph.nodes;
     bool vehicleNode = !!getCurrentVehicle();
-    AIGraphNode* nearest = nullptr;
-    float d = std::numeric_limits<float>::max();
-    for (const auto& node : nodes) {
-        if (vehicleNode) {
-            if (node->type == AIGraphNode::Pedestrian) continue;
-        } else {
-            if (node->type == AIGraphNode::Vehicle) continue;
-        }
-
-        float dist = glm::length(node->position - getPosition());
-        if (dist < d) {
-            nearest = node.get();
-            d = dist;
-        }
-    }
+    AIGraphNode* nearest = engine->aigraph.findNearest(
+        vehicleNode ? AIGraphNode::Vehicle : AIGraphNode::Pedestrian,
+        getPosition());
 
     if (nearest) {
         if (vehicleNode) {
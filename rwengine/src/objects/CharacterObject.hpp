@@ -63,6 +63,14 @@ private:
     void createActor(const glm::vec2& size = glm::vec2(0.45f, 1.2f));
     void destroyActor();
 
+    /**
+     * @brief Places the clump in its seat of the current vehicle
+     *
+     * Done during the serial part of the tick so that rendering only ever
+     * reads frame transforms.
+     */
+    void updateSeatTransform();
+
     glm::vec3 movement{};
     glm::vec2 m_look{0.f, glm::half_pi<float>()};
 
@@ -106,6 +114,9 @@ public:
     }
 
     void tick(float dt) override;
+    void tickBeforeAnimation(float dt) override;
+    void tickAnimation(float dt) override;
+    void tickAfterAnimation(float dt) override;
 
     void tickPhysics(float dt);
 
@@ -20,9 +20,17 @@ CutsceneObject::CutsceneObject(GameWorld *engine, const glm::vec3 &pos,
 }
 
 void CutsceneObject::tick(float dt) {
+    tickAnimation(dt);
+}
+
+void CutsceneObject::tickAnimation(float dt) {
     animator->tick(dt);
 }
 
+void CutsceneObject::tickAfterAnimation(float dt) {
+    RW_UNUSED(dt);
+}
+
 void CutsceneObject::setParentActor(GameObject *parent, ModelFrame *bone) {
     _parent = parent;
     _bone = bone;
@@ -28,6 +28,8 @@ public:
     }
 
     void tick(float dt) override;
+    void tickAnimation(float dt) override;
+    void tickAfterAnimation(float dt) override;
 
     void setParentActor(GameObject* parent, ModelFrame* bone);
 
@@ -1,6 +1,8 @@
 #ifndef _RWENGINE_GAMEOBJECT_HPP_
 #define _RWENGINE_GAMEOBJECT_HPP_
 
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 
 #include <glm/glm.hpp>
@@ -26,6 +28,8 @@ class GameObject {
     glm::vec3 _lastPosition;
     glm::quat _lastRotation;
     GameObjectID objectID = 0;
+    /// Position in GameWorld::allObjects
+    size_t allObjectsIndex = 0;
 
     BaseModelInfo* modelinfo_;
 
@@ -128,6 +132,13 @@ public:
         return Unknown;
     }
 
+    /**
+     * @return The bit for a type in masks of object types
+     */
+    static constexpr uint32_t typeMask(Type type) {
+        return 1u << type;
+    }
+
     virtual void setPosition(const glm::vec3& pos);
 
     const glm::vec3& getPosition() const {
@@ -207,6 +218,35 @@ public:
 
     virtual void tick(float dt) = 0;
 
+    /**
+     * @brief tickBeforeAnimation Runs the part of tick() that comes before
+     * the animation is advanced, objects are called one at a time
+     *
+     * GameWorld ticks objects in three phases so that animation can run in
+     * parallel. Calling the three in order does the same as tick().
+     */
+    virtual void tickBeforeAnimation(float dt) {
+        RW_UNUSED(dt);
+    }
+
+    /**
+     * @brief tickAnimation Advances the object's animation
+     *
+     * Called for many objects at once from different threads, so it may only
+     * change this object's own animation and pose.
+     */
+    virtual void tickAnimation(float dt) {
+        RW_UNUSED(dt);
+    }
+
+    /**
+     * @brief tickAfterAnimation Runs the rest of tick(), objects are called
+     * one at a time
+     */
+    virtual void tickAfterAnimation(float dt) {
+        tick(dt);
+    }
+
     /**
      * @brief Function used to modify the last transform
      * @param newPos
@@ -250,6 +290,8 @@ public:
 
 private:
     ObjectLifetime lifetime = GameObject::UnknownLifetime;
+
+    friend class GameWorld;
 };
 
 class ClumpObject {
@@ -22,8 +22,10 @@
 InstanceObject::InstanceObject(GameWorld* engine, const glm::vec3& pos,
                                const glm::quat& rot, const glm::vec3& scale,
                                BaseModelInfo* modelinfo,
-                               const std::shared_ptr<DynamicObjectData>& dyn)
+                               const std::shared_ptr<DynamicObjectData>& dyn,
+                               bool streamModel)
     : GameObject(engine, pos, rot, modelinfo)
+    , streamModel(streamModel)
     , scale(scale)
     , dynamics(dyn) {
     if (modelinfo) {
@@ -76,8 +78,9 @@ void InstanceObject::tickPhysics(float dt) {
         changeAtomic = -1;
     }
 
-    if (usePhysics) {
+    if (physicsState == PhysicsState::Uprooted) {
         body->changeMass(dynamics->mass);
+        physicsState = PhysicsState::Dynamic;
     }
 
     // Only certain objects should float on water
@@ -139,6 +142,21 @@ void InstanceObject::tickPhysics(float dt) {
     }
 }
 
+bool InstanceObject::needsPhysicsTick() const {
+    if (animator || changeAtomic != -1) {
+        return true;
+    }
+    if (!body || !dynamics) {
+        return false;
+    }
+    // Floating objects are pushed around by the waves
+    return floating || physicsState == PhysicsState::Uprooted;
+}
+
+void InstanceObject::wake() {
+    engine->wakeInstance(this);
+}
+
 void InstanceObject::changeModel(BaseModelInfo* incoming, int atomicNumber) {
     if (body) {
         body.reset();
@@ -146,30 +164,60 @@ void InstanceObject::changeModel(BaseModelInfo* incoming, int atomicNumber) {
 
     if (incoming) {
         if (!incoming->isLoaded()) {
-            engine->data->loadModel(incoming->id());
+            if (streamModel) {
+                // Without an atomic the renderer requests the new model and
+                // draws the LOD until it is ready, rather than keeping the
+                // old model forever
+                atomic_.reset();
+                setModel(nullptr);
+            } else {
+                engine->data->loadModel(incoming->id());
+            }
         }
 
         changeModelInfo(incoming);
-        /// @todo this should only be temporary
-        setModel(getModelInfo<SimpleModelInfo>()->getModel());
         auto collision = getModelInfo<SimpleModelInfo>()->getCollision();
 
         RW_ASSERT(getModelInfo<SimpleModelInfo>()->getNumAtomics() >
                   atomicNumber);
-        auto atomic = getModelInfo<SimpleModelInfo>()->getAtomic(atomicNumber);
-        if (atomic) {
-            auto previous = atomic_;
-            atomic_ = atomic->clone();
-            if (previous) {
-                atomic_->setFrame(previous->getFrame());
-            } else {
-                atomic_->setFrame(std::make_shared<ModelFrame>());
-            }
-        }
+        this->atomicNumber = atomicNumber;
+        setupAtomic();
 
         if (collision) {
             body = std::make_unique<CollisionInstance>();
             body->createPhysicsBody(this, collision, dynamics.get());
+
+            // The new body is fixed in place again, give it back its mass
+            if (physicsState == PhysicsState::Dynamic) {
+                physicsState = PhysicsState::Uprooted;
+                wake();
+            }
+        }
+    }
+}
+
+void InstanceObject::setupAtomic() {
+    auto modelinfo = getModelInfo<SimpleModelInfo>();
+    if (!modelinfo->isLoaded()) {
+        return;
+    }
+
+    /// @todo this should only be temporary
+    setModel(modelinfo->getModel());
+
+    auto atomic = modelinfo->getAtomic(atomicNumber);
+    if (atomic) {
+        auto previous = atomic_;
+        atomic_ = atomic->clone();
+        if (previous) {
+            atomic_->setFrame(previous->getFrame());
+        } else {
+            atomic_->setFrame(std::make_shared<ModelFrame>());
+            atomic_->getFrame()->setRotation(glm::mat3_cast(getRotation()));
+            atomic_->getFrame()->setTranslation(getPosition());
+            // This runs while the render list is built, resolve the new
+            // frame now rather than on its first read
+            atomic_->getFrame()->updateHierarchyTransform();
         }
     }
 }
@@ -178,17 +226,24 @@ void InstanceObject::setPosition(const glm::vec3& pos) {
     if (body) {
         auto& wtr = body->getBulletBody()->getWorldTransform();
         wtr.setOrigin(btVector3(pos.x, pos.y, pos.z));
+        if (body->getBulletBody()->isStaticObject()) {
+            engine->clearGroundCache();
+        }
     }
     if (atomic_) {
         atomic_->getFrame()->setTranslation(pos);
     }
     GameObject::setPosition(pos);
+    engine->instanceGrid.update(this);
 }
 
 void InstanceObject::setRotation(const glm::quat& r) {
     if (body) {
         auto& wtr = body->getBulletBody()->getWorldTransform();
         wtr.setRotation(btQuaternion(r.x, r.y, r.z, r.w));
+        if (body->getBulletBody()->isStaticObject()) {
+            engine->clearGroundCache();
+        }
     }
     if (atomic_) {
         atomic_->getFrame()->setRotation(glm::mat3_cast(r));
@@ -207,6 +262,7 @@ void InstanceObject::setStatic(bool s) {
 
     body->getBulletBody()->setCollisionFlags(flags);
     static_ = s;
+    engine->clearGroundCache();
 }
 
 bool InstanceObject::takeDamage(const GameObject::DamageInfo& dmg) {
@@ -218,17 +274,21 @@ bool InstanceObject::takeDamage(const GameObject::DamageInfo& dmg) {
 
     if (dmg.hitpoints > 0.f) {
         if (effect || dynamics->collResponseFlags) {
-            if (dmg.impulse >= dynamics->uprootForce && !isStatic()) {
-                usePhysics = true;
+            if (dmg.impulse >= dynamics->uprootForce && !isStatic() &&
+                physicsState == PhysicsState::Fixed) {
+                physicsState = PhysicsState::Uprooted;
+                wake();
             }
         }
 
         switch (effect) {
             case DynamicObjectData::Damage_ChangeModel:
                 changeAtomic = 1;
+                wake();
                 break;
             case DynamicObjectData::Damage_ChangeThenSmash:
                 changeAtomic = 1;
+                wake();
                 RW_UNIMPLEMENTED(
                     "Collision Damage Effect: Changing, then Smashing");
                 break;
@@ -262,12 +322,16 @@ void InstanceObject::setSolid(bool solid) {
         flags |= btCollisionObject::CF_NO_CONTACT_RESPONSE;
     }
     body->getBulletBody()->setCollisionFlags(flags);
+    engine->clearGroundCache();
 }
 
 void InstanceObject::updateTransform(const glm::vec3& pos,
                                      const glm::quat& rot) {
     position = pos;
     rotation = rot;
-    getAtomic()->getFrame()->setRotation(glm::mat3_cast(rot));
-    getAtomic()->getFrame()->setTranslation(pos);
+    if (atomic_) {
+        atomic_->getFrame()->setRotation(glm::mat3_cast(rot));
+        atomic_->getFrame()->setTranslation(pos);
+    }
+    engine->instanceGrid.update(this);
 }
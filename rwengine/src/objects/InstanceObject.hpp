@@ -17,12 +17,28 @@ class GameWorld;
  *  A simple object instance
  */
 class InstanceObject final : public GameObject {
+public:
+    enum class PhysicsState {
+        /// Hasn't been knocked loose, objects with an uproot force have no
+        /// mass until then
+        Fixed,
+        /// Knocked loose, the mass is applied by the next physics tick
+        Uprooted,
+        /// Has its mass and moves freely
+        Dynamic
+    };
+
+private:
     float health = 100.f;
     bool visible =true;
     bool floating = false;
     bool static_ = false;
-    bool usePhysics = false;
+    PhysicsState physicsState = PhysicsState::Fixed;
+    /// In GameWorld's list of instances to tick the physics of
+    bool awake = false;
+    bool streamModel = false;
     int changeAtomic = -1;
+    int atomicNumber = 0;
 
     /**
      * The Atomic instance for this object
@@ -34,10 +50,15 @@ public:
     std::unique_ptr<CollisionInstance> body;
     std::shared_ptr<DynamicObjectData> dynamics;
 
+    /**
+     * @param streamModel if true the model isn't loaded here, the atomic is
+     * created by setupAtomic() once the model has been streamed in
+     */
     InstanceObject(GameWorld* engine, const glm::vec3& pos,
                    const glm::quat& rot, const glm::vec3& scale,
                    BaseModelInfo* modelinfo,
-                   const std::shared_ptr<DynamicObjectData>& dyn);
+                   const std::shared_ptr<DynamicObjectData>& dyn,
+                   bool streamModel = false);
     ~InstanceObject() override;
 
     Type type() const override {
@@ -52,8 +73,33 @@ public:
 
     void tickPhysics(float dt);
 
+    /**
+     * @brief needsPhysicsTick
+     * @return false once tickPhysics has nothing left to do, until the
+     * object is woken again
+     */
+    bool needsPhysicsTick() const;
+
+    /**
+     * @brief wake Puts the object back into the physics tick
+     */
+    void wake();
+
+    bool isAwake() const {
+        return awake;
+    }
+
+    PhysicsState getPhysicsState() const {
+        return physicsState;
+    }
+
     void changeModel(BaseModelInfo* incoming, int atomicNumber = 0);
 
+    /**
+     * Creates the atomic for the current model, if the model is loaded
+     */
+    void setupAtomic();
+
     void setPosition(const glm::vec3& pos) override;
 
     void setRotation(const glm::quat& r) override;
@@ -78,6 +124,10 @@ public:
 
     void setFloating(bool f) {
         floating = f;
+        // Floating objects are ticked to be pushed around by the waves
+        if (floating) {
+            wake();
+        }
     }
 
     bool isFloating() const {
@@ -89,6 +139,8 @@ public:
     }
 
     void updateTransform(const glm::vec3& pos, const glm::quat& rot) override;
+
+    friend class GameWorld;
 };
 
 #endif
@@ -1,5 +1,7 @@
 #include "objects/ProjectileObject.hpp"
 
+#include <vector>
+
 #ifdef _MSC_VER
 #pragma warning(disable : 4305 5033)
 #endif
@@ -64,19 +66,13 @@ void ProjectileObject::explode() {
         const float damageSize = 5.f;
         const float damage = static_cast<float>(_info.weapon->damage);
 
-        for (auto& o : engine->allObjects) {
-            if (o == this) continue;
-            switch (o->type()) {
-                case GameObject::Instance:
-                case GameObject::Vehicle:
-                case GameObject::Character:
-                    break;
-                default:
-                    continue;
-            }
-
+        std::vector<GameObject*> objects;
+        engine->findObjectsInSphere(getPosition(), damageSize,
+                                    typeMask(Instance) | typeMask(Vehicle) |
+                                        typeMask(Character),
+                                    objects);
+        for (auto o : objects) {
             float d = glm::distance(getPosition(), o->getPosition());
-            if (d > damageSize) continue;
 
             o->takeDamage({getPosition(), getPosition(),
                            damage / glm::max(d, 1.f), DamageInfo::Explosion,
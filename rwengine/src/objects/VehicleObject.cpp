@@ -273,6 +273,7 @@ void VehicleObject::setupModel() {
 void VehicleObject::setPosition(const glm::vec3& pos) {
     GameObject::setPosition(pos);
     getClump()->getFrame()->setTranslation(pos);
+    engine->markDynamicObjectGridDirty();
     if (collision->getBulletBody()) {
         auto bodyOrigin = btVector3(position.x, position.y, position.z);
         for (auto& part : dynamicParts) {
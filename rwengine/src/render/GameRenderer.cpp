@@ -11,6 +11,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include <data/Clump.hpp>
 #include <gl/TextureData.hpp>
 #include <rw/types.hpp>
 
@@ -20,13 +21,47 @@
 #include "engine/GameState.hpp"
 #include "engine/GameWorld.hpp"
 #include "loaders/WeatherLoader.hpp"
+#include "objects/CharacterObject.hpp"
+#include "objects/CutsceneObject.hpp"
 #include "objects/GameObject.hpp"
+#include "objects/InstanceObject.hpp"
+#include "objects/VehicleObject.hpp"
 #include "render/ObjectRenderer.hpp"
 #include "render/GameShaders.hpp"
 #include "render/VisualFX.hpp"
 
 constexpr size_t skydomeSegments = 8, skydomeRows = 10;
 
+/// Number of objects in each chunk of the render list, chunks are fixed so
+/// the list doesn't depend on which thread built each one
+constexpr size_t kObjectsPerChunk = 256;
+
+namespace {
+ModelFrame *getRootFrame(const ClumpObject *object) {
+    const auto &clump = object->getClump();
+    return clump ? clump->getFrame().get() : nullptr;
+}
+
+/// Frame the renderer reads the object's transform from, if any
+ModelFrame *getRootFrame(GameObject *object) {
+    switch (object->type()) {
+        case GameObject::Instance: {
+            auto instance = static_cast<InstanceObject *>(object);
+            const auto &atomic = instance->getAtomic();
+            return atomic ? atomic->getFrame().get() : nullptr;
+        }
+        case GameObject::Character:
+            return getRootFrame(static_cast<CharacterObject *>(object));
+        case GameObject::Vehicle:
+            return getRootFrame(static_cast<VehicleObject *>(object));
+        case GameObject::Cutscene:
+            return getRootFrame(static_cast<CutsceneObject *>(object));
+        default:
+            return nullptr;
+    }
+}
+}  // namespace
+
 /// @todo collapse all of these into "VertPNC" etc.
 struct ParticleVert {
     static const AttributeList vertex_attributes() {
@@ -40,9 +75,10 @@ struct ParticleVert {
     float r, g, b;
 };
 
-GameRenderer::GameRenderer(Logger* log, GameData* _data)
+GameRenderer::GameRenderer(Logger* log, GameData* _data, JobSystem* _jobs)
     : data(_data)
     , logger(log)
+    , jobs(_jobs)
     , map(renderer, _data)
     , water(this)
     , text(this) {
@@ -187,6 +223,9 @@ void GameRenderer::renderWorld(GameWorld* world, const ViewCamera& camera,
     // Store the input camera,
     _camera = camera;
 
+    // Upload models that finished streaming since the last frame
+    world->data->updateStreaming();
+
     setupRender();
 
     glBindVertexArray(vao);
@@ -297,7 +336,7 @@ void GameRenderer::renderObjects(const GameWorld *world) {
     RW_PROFILE_SCOPE(__func__);
 
     renderer->useProgram(worldProg.get());
-    RenderList renderList = createObjectRenderList(world);
+    const auto &renderList = createObjectRenderList(world);
 
     renderer->pushDebugGroup("Objects");
     renderer->pushDebugGroup("RenderList");
@@ -307,23 +346,57 @@ void GameRenderer::renderObjects(const GameWorld *world) {
     profObjects = renderer->popDebugGroup();
 }
 
-RenderList GameRenderer::createObjectRenderList(const GameWorld *world) {
+const RenderList &GameRenderer::createObjectRenderList(const GameWorld *world) {
     RW_PROFILE_SCOPE(__func__);
-    // This is sequential at the moment, it should be easy to make it
-    // run in parallel with a good threading system.
-    RenderList renderList;
-    // Naive optimisation, assume 50% hitrate
-    renderList.reserve(static_cast<size_t>(world->allObjects.size() * 0.5f));
-
-    ObjectRenderer objectRenderer(_renderWorld,
-                                  (cullOverride ? cullingCamera : _camera),
-                                  _renderAlpha);
-
-    // World Objects
-    for (auto object : world->allObjects) {
-        objectRenderer.buildRenderList(object, renderList);
+    const auto &camera = cullOverride ? cullingCamera : _camera;
+
+    // Instances are culled by grid cell first, everything else is checked
+    // one by one
+    auto &objects = visibleObjects;
+    objects.clear();
+    world->instanceGrid.findVisible(camera, kDrawDistanceFactor, objects);
+    const ObjectPool *pools[] = {&world->pedestrianPool, &world->vehiclePool,
+                                 &world->pickupPool, &world->cutscenePool,
+                                 &world->projectilePool};
+    for (const auto *pool : pools) {
+        const auto &poolObjects = pool->getObjects();
+        objects.insert(objects.end(), poolObjects.begin(), poolObjects.end());
+    }
+
+    // World objects are split into fixed chunks which are built in parallel.
+    // The extra chunk at the end holds the indicators.
+    const size_t objectChunks =
+        (objects.size() + kObjectsPerChunk - 1) / kObjectsPerChunk;
+    renderChunks.resize(objectChunks + 1);
+
+    // Frames compute their world transform lazily, resolve them here so the
+    // jobs below only read them. Characters read their vehicle's frame and
+    // cutscene objects their parent's, so every frame has to be clean first.
+    for (auto *object : objects) {
+        if (auto frame = getRootFrame(object)) {
+            frame->updateHierarchyTransform();
+        }
     }
 
+    jobs->parallelFor(objectChunks, [&](size_t c) {
+        RW_PROFILE_SCOPE("buildRenderList");
+        auto &chunk = renderChunks[c];
+        chunk.renderList.clear();
+
+        ObjectRenderer objectRenderer(_renderWorld, camera, _renderAlpha);
+        const auto end = std::min(objects.size(), (c + 1) * kObjectsPerChunk);
+        for (size_t i = c * kObjectsPerChunk; i < end; ++i) {
+            objectRenderer.buildRenderList(objects[i], chunk.renderList);
+        }
+
+        chunk.culled = objectRenderer.culled;
+        chunk.modelRequests = std::move(objectRenderer.modelRequests);
+    });
+
+    auto &indicators = renderChunks.back();
+    indicators.renderList.clear();
+    ObjectRenderer objectRenderer(_renderWorld, camera, _renderAlpha);
+
     // Area indicators
     auto sphereModel = getSpecialModel(ZoneCylinderA);
     for (auto &i : world->getAreaIndicators()) {
@@ -333,7 +406,8 @@ RenderList GameRenderer::createObjectRenderList(const GameWorld *world) {
                 m, glm::vec3(i.radius +
                              0.15f * sin(_renderWorld->getGameTime() * 5.f)));
 
-        objectRenderer.renderClump(sphereModel.get(), m, nullptr, renderList);
+        objectRenderer.renderClump(sphereModel.get(), m, nullptr,
+                                   indicators.renderList);
     }
 
     // Render arrows above anything that isn't radar only (or hidden)
@@ -360,25 +434,31 @@ RenderList GameRenderer::createObjectRenderList(const GameWorld *world) {
                           glm::vec3(0.f, 0.f, 2.5f + sin(a) * 0.5f));
         model = rotate(model, a, glm::vec3(0.f, 0.f, 1.f));
         model = scale(model, glm::vec3(1.5f, 1.5f, 1.5f));
-        objectRenderer.renderClump(arrowModel.get(), model, nullptr, renderList);
+        objectRenderer.renderClump(arrowModel.get(), model, nullptr,
+                                   indicators.renderList);
+    }
+    indicators.culled = objectRenderer.culled;
+    indicators.modelRequests.clear();
+
+    // Streaming requests are made here, in chunk order, as GameData isn't
+    // safe to use from the jobs
+    for (const auto &chunk : renderChunks) {
+        culled += chunk.culled;
+        for (const auto &request : chunk.modelRequests) {
+            data->requestModel(request.first, request.second);
+        }
     }
-    culled += objectRenderer.culled;
 
     RW_PROFILE_SCOPE("sortRenderList");
-    // Also parallelizable
-    // Earlier position in the array means earlier object's rendering
-    // Transparent objects should be sorted and rendered after opaque
-    sort(renderList.begin(), renderList.end(),
-         [](const Renderer::RenderInstruction &a,
-            const Renderer::RenderInstruction &b) {
-             if (a.drawInfo.blendMode == BlendMode::BLEND_NONE && b.drawInfo.blendMode != BlendMode::BLEND_NONE)
-                 return true;
-             if (a.drawInfo.blendMode != BlendMode::BLEND_NONE && b.drawInfo.blendMode == BlendMode::BLEND_NONE)
-                 return false;
-             return (a.sortKey > b.sortKey);
-         });
-
-    return renderList;
+    // The sort is stable, so equal keys keep the order of their chunks and
+    // the result is the same on every run.
+    objectList.clear();
+    for (const auto &chunk : renderChunks) {
+        objectList.append(chunk.renderList);
+    }
+    objectSorter.sort(objectList);
+
+    return objectList;
 }
 
 void GameRenderer::renderSplash(GameWorld* world, GLuint splashTexName, glm::u16vec3 fc) {
@@ -3,6 +3,8 @@
 
 #include <cstddef>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <glm/glm.hpp>
 
@@ -12,8 +14,11 @@
 
 #include <rw/forward.hpp>
 
+#include <core/JobSystem.hpp>
+#include <data/ModelData.hpp>
 #include <render/OpenGLRenderer.hpp>
 #include <render/MapRenderer.hpp>
+#include <render/RenderSort.hpp>
 #include <render/TextRenderer.hpp>
 #include <render/ViewCamera.hpp>
 #include <render/WaterRenderer.hpp>
@@ -54,6 +59,24 @@ class GameRenderer {
     /** Number of culling events */
     size_t culled;
 
+    /** Part of the object render list, built by one job */
+    struct RenderChunk {
+        RenderList renderList;
+        size_t culled = 0;
+        std::vector<std::pair<ModelID, int>> modelRequests;
+    };
+    std::vector<RenderChunk> renderChunks;
+
+    /** Objects that passed the grid culling, kept to reuse the storage */
+    std::vector<GameObject*> visibleObjects;
+
+    /** Sorted object draws, kept between frames to reuse the storage */
+    RenderList objectList;
+    RenderListSorter objectSorter;
+
+    /** Workers used to build the render list, shared with the world */
+    JobSystem* jobs;
+
     GLuint framebufferName;
     GLuint fbTextures[2];
     GLuint fbRenderBuffers[1];
@@ -66,7 +89,7 @@ class GameRenderer {
     DrawBuffer ssRectDraw;
 
 public:
-    GameRenderer(Logger* log, GameData* data);
+    GameRenderer(Logger* log, GameData* data, JobSystem* jobs);
     ~GameRenderer();
 
     std::unique_ptr<Renderer::ShaderProgram> worldProg;
@@ -167,7 +190,10 @@ private:
 
     void renderObjects(const GameWorld *world);
 
-    RenderList createObjectRenderList(const GameWorld *world);
+    /**
+     * @return The sorted object draws, valid until the next call
+     */
+    const RenderList& createObjectRenderList(const GameWorld *world);
 };
 
 #endif
@@ -13,6 +13,7 @@
 #include "engine/GameData.hpp"
 #include "engine/GameState.hpp"
 #include "engine/GameWorld.hpp"
+#include "objects/CharacterObject.hpp"
 #include "objects/GameObject.hpp"
 
 const char* MapVertexShader = R"(
@@ -18,6 +18,7 @@
 #include "engine/GameData.hpp"
 #include "engine/GameState.hpp"
 #include "engine/GameWorld.hpp"
+#include "render/RenderSort.hpp"
 #include "render/ViewCamera.hpp"
 
 // Objects that we know how to turn into renderlist entries
@@ -32,7 +33,6 @@
 #include <rw_mingw.hpp>
 #endif
 
-constexpr float kDrawDistanceFactor = 1.5f;
 constexpr float kVehicleDrawDistanceFactor = kDrawDistanceFactor;
 #if 0  // There's no distance based culling for these types of objects yet
 constexpr float kPedestrianDrawDistanceFactor = kDrawDistanceFactor;
@@ -41,14 +41,17 @@ constexpr float kMagicLODDistance = 330.f;
 constexpr float kVehicleLODDistance = 70.f;
 constexpr float kVehicleDrawDistance = 280.f;
 
-RenderKey createKey(float normalizedDepth, Renderer::Textures& textures) {
-    return (uint32_t(0x7FFFFF * normalizedDepth) << 8 |
-            uint8_t(0xFF & (!textures.empty() ? textures[0] : 0)));
-}
-
 void ObjectRenderer::renderGeometry(Geometry* geom,
                                     const glm::mat4& modelMatrix,
                                     GameObject* object, RenderList& outList) {
+    // Every subgeometry is drawn with the same matrix
+    const auto transform = outList.addTransform(modelMatrix);
+
+    glm::vec3 position(modelMatrix[3]);
+    float distance = glm::length(m_camera.position - position);
+    float depth = (distance - m_camera.frustum.near) /
+                  (m_camera.frustum.far - m_camera.frustum.near);
+
     for (SubGeometry& subgeom : geom->subgeom) {
         bool isTransparent = false;
 
@@ -107,12 +110,8 @@ void ObjectRenderer::renderGeometry(Geometry* geom,
 
         dp.blendMode = isTransparent ? BlendMode::BLEND_ALPHA : BlendMode::BLEND_NONE;
 
-        glm::vec3 position(modelMatrix[3]);
-        float distance = glm::length(m_camera.position - position);
-        float depth = (distance - m_camera.frustum.near) /
-                      (m_camera.frustum.far - m_camera.frustum.near);
-        outList.emplace_back(createKey(depth * depth, dp.textures), modelMatrix,
-                             &geom->dbuff, dp);
+        outList.add(createRenderKey(dp, &geom->dbuff, depth * depth),
+                    transform, &geom->dbuff, dp);
     }
 }
 
@@ -152,11 +151,6 @@ void ObjectRenderer::renderClump(Clump* model, const glm::mat4& worldtransform,
 
 void ObjectRenderer::renderInstance(InstanceObject* instance,
                                     RenderList& outList) {
-    const auto& atomic = instance->getAtomic();
-    if (!atomic) {
-        return;
-    }
-
     // Only draw visible objects
     if (!instance->isVisible()) {
         return;
@@ -194,6 +188,22 @@ void ObjectRenderer::renderInstance(InstanceObject* instance,
         }
     }
 
+    if (!instance->getAtomic()) {
+        // Until the model is streamed in the big building LOD, if any,
+        // is drawn in its place
+        if (!modelinfo->isLoaded()) {
+            modelRequests.emplace_back(modelinfo->id(),
+                                       -static_cast<int>(mindist));
+            return;
+        }
+        instance->setupAtomic();
+    }
+
+    const auto& atomic = instance->getAtomic();
+    if (!atomic) {
+        return;
+    }
+
     Atomic* distanceatomic =
         modelinfo->getDistanceAtomic(mindist / kDrawDistanceFactor);
     if (!distanceatomic) {
@@ -210,26 +220,6 @@ void ObjectRenderer::renderInstance(InstanceObject* instance,
 
 void ObjectRenderer::renderCharacter(CharacterObject* pedestrian,
                                      RenderList& outList) {
-    const auto& clump = pedestrian->getClump();
-
-    if (pedestrian->getCurrentVehicle()) {
-        auto vehicle = pedestrian->getCurrentVehicle();
-        const auto& vehicleclump = vehicle->getClump();
-        auto seat = pedestrian->getCurrentSeat();
-        auto matrixModel = vehicleclump->getFrame()->getWorldTransform();
-        if (pedestrian->isEnteringOrExitingVehicle()) {
-            matrixModel = glm::translate(matrixModel,
-                                         vehicle->getSeatEntryPosition(seat));
-            clump->getFrame()->setTransform(matrixModel);
-        } else {
-            if (seat < vehicle->info->seats.size()) {
-                matrixModel = glm::translate(matrixModel,
-                                             vehicle->info->seats[seat].offset);
-                clump->getFrame()->setTransform(matrixModel);
-            }
-        }
-    }
-
     renderClump(pedestrian->getClump().get(), glm::mat4(1.0f), nullptr,
                 outList);
 
@@ -2,12 +2,15 @@
 #define _RWENGINE_OBJECTRENDERER_HPP_
 
 #include <cstddef>
+#include <utility>
+#include <vector>
 
 #include <gl/gl_core_3_3.h>
 
 //#include <engine/GameWorld.hpp>
 //#include <gl/DrawBuffer.hpp>
 #include <glm/glm.hpp>
+#include <data/ModelData.hpp>
 //#include <objects/GameObject.hpp>
 #include <render/OpenGLRenderer.hpp>
 //#include <render/ViewCamera.hpp>
@@ -26,6 +29,9 @@ class VehicleObject;
 class ViewCamera;
 struct Geometry;
 
+/// Scales the distance objects are drawn at
+constexpr float kDrawDistanceFactor = 1.5f;
+
 /**
  * @brief The ObjectRenderer class handles object -> renderer transformation
  *
@@ -49,6 +55,13 @@ public:
     size_t culled = 0;
     void buildRenderList(GameObject* object, RenderList& outList);
 
+    /**
+     * Models that need to be streamed in and their priorities. They are
+     * requested by the owner once the list is built, as lists may be built
+     * on several threads at once.
+     */
+    std::vector<std::pair<ModelID, int>> modelRequests;
+
     void renderGeometry(Geometry* geom, const glm::mat4& modelMatrix,
                         GameObject* object, RenderList& outList);
 
@@ -1,5 +1,6 @@
 #include "render/OpenGLRenderer.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <sstream>
 
@@ -13,7 +14,30 @@
 namespace {
 constexpr GLuint kUBOIndexScene = 1;
 constexpr GLuint kUBOIndexDraw = 2;
+
+// The world shaders read ObjectData as a std140 array
+static_assert(sizeof(Renderer::ObjectUniformData) % 16 == 0,
+              "ObjectUniformData must match the std140 array stride");
+
+Renderer::ObjectUniformData createObjectData(
+    const glm::mat4& model, const Renderer::DrawParameters& p) {
+    return {model,
+            glm::vec4(p.colour.r / 255.f, p.colour.g / 255.f,
+                      p.colour.b / 255.f, p.colour.a / 255.f),
+            1.f, 1.f, p.visibility, 0.f};
+}
+
+/// Draws can be instanced if only their object data differs
+bool canInstance(const RenderList::DrawState& a,
+                 const RenderList::DrawState& b) {
+    return a.dbuff == b.dbuff && a.drawInfo.start == b.drawInfo.start &&
+           a.drawInfo.count == b.drawInfo.count &&
+           a.drawInfo.textures == b.drawInfo.textures &&
+           a.drawInfo.blendMode == b.drawInfo.blendMode &&
+           a.drawInfo.depthMode == b.drawInfo.depthMode &&
+           a.drawInfo.depthWrite == b.drawInfo.depthWrite;
 }
+}  // namespace
 
 GLuint compileShader(GLenum type, const char* source) {
     GLuint shader = glCreateShader(type);
@@ -97,6 +121,46 @@ void Renderer::setViewport(const glm::ivec2& vp) {
                               static_cast<float>(viewport.y), 0.f, -1.f, 1.f);
 }
 
+void Renderer::RenderList::append(const RenderList& other) {
+    const auto offset = static_cast<uint32_t>(transforms.size());
+    keys.insert(keys.end(), other.keys.begin(), other.keys.end());
+    for (const auto index : other.transformIndices) {
+        transformIndices.push_back(index + offset);
+    }
+    states.insert(states.end(), other.states.begin(), other.states.end());
+    transforms.insert(transforms.end(), other.transforms.begin(),
+                      other.transforms.end());
+}
+
+void Renderer::drawBatched(const RenderList& list) {
+    RW_PROFILE_SCOPE(__func__);
+    for (size_t batch = 0; batch < list.size(); batch += kMaxBatchObjects) {
+        const auto end = std::min(list.size(), batch + kMaxBatchObjects);
+
+        batchObjects.clear();
+        for (size_t i = batch; i < end; ++i) {
+            batchObjects.push_back(
+                createObjectData(list.getTransform(i), list.states[i].drawInfo));
+        }
+        const auto firstObject =
+            uploadObjects(batchObjects.data(), batchObjects.size());
+
+        for (size_t first = batch; first < end;) {
+            auto last = first + 1;
+            while (last < end &&
+                   canInstance(list.states[first], list.states[last])) {
+                ++last;
+            }
+
+            const auto& state = list.states[first];
+            drawInstances(state.dbuff, state.drawInfo,
+                          firstObject + static_cast<GLuint>(first - batch),
+                          static_cast<GLsizei>(last - first));
+            first = last;
+        }
+    }
+}
+
 void Renderer::swap() {
     drawCounter = 0;
     textureCounter = 0;
@@ -165,10 +229,9 @@ OpenGLRenderer::OpenGLRenderer() {
     createUBO(UBOScene, sizeof(SceneUniformData), sizeof(SceneUniformData));
     glBindBufferBase(GL_UNIFORM_BUFFER, kUBOIndexScene, UBOScene.name);
 
-    GLint MaxUBOSize;
-    glGetIntegerv(GL_MAX_UNIFORM_BLOCK_SIZE, &MaxUBOSize);
-
-    createUBO(UBOObject, MaxUBOSize, sizeof(ObjectUniformData));
+    createUBO(UBOObject, sizeof(ObjectUniformData) * kMaxBatchObjects,
+              sizeof(ObjectUniformData));
+    glBindBufferBase(GL_UNIFORM_BUFFER, kUBOIndexDraw, UBOObject.name);
 
     swap();
 }
@@ -268,8 +331,8 @@ void OpenGLRenderer::setSceneParameters(
     lastSceneData = data;
 }
 
-void OpenGLRenderer::setDrawState(const glm::mat4& model, DrawBuffer* draw,
-                                  const Renderer::DrawParameters& p) {
+void OpenGLRenderer::useDrawParameters(DrawBuffer* draw,
+                                       const Renderer::DrawParameters& p) {
     useDrawBuffer(draw);
 
     for (GLuint u = 0; u < p.textures.size(); ++u) {
@@ -279,12 +342,21 @@ void OpenGLRenderer::setDrawState(const glm::mat4& model, DrawBuffer* draw,
     setBlend(p.blendMode);
     setDepthWrite(p.depthWrite);
     setDepthMode(p.depthMode);
+}
 
-    ObjectUniformData objectData{model,
-                             glm::vec4(p.colour.r / 255.f, p.colour.g / 255.f,
-                                       p.colour.b / 255.f, p.colour.a / 255.f),
-                             1.f, 1.f, p.visibility};
-    uploadUBO(UBOObject, objectData);
+void OpenGLRenderer::setObjectBase(GLuint firstObject) {
+    if (currentProgram) {
+        glUniform1i(currentProgram->getObjectBaseLocation(),
+                    static_cast<GLint>(firstObject));
+    }
+}
+
+void OpenGLRenderer::setDrawState(const glm::mat4& model, DrawBuffer* draw,
+                                  const Renderer::DrawParameters& p) {
+    useDrawParameters(draw, p);
+
+    const auto objectData = createObjectData(model, p);
+    setObjectBase(uploadObjects(&objectData, 1));
 
     drawCounter++;
 #ifdef RW_GRAPHICS_STATS
@@ -311,55 +383,55 @@ void OpenGLRenderer::drawArrays(const glm::mat4& model, DrawBuffer* draw,
     glDrawArrays(draw->getFaceType(), static_cast<GLint>(p.start), static_cast<GLsizei>(p.count));
 }
 
-void OpenGLRenderer::drawBatched(const RenderList& list) {
-    RW_PROFILE_SCOPE(__func__);
-#if 0  // Needs shader changes
-	// Determine how many batches we need to process the entire list
-	auto entries = list.size();
-	glBindBuffer(GL_UNIFORM_BUFFER, UBOObject);
-	for (int b = 0; b < entries; b += maxObjectEntries)
-	{
-		auto toConsume = std::min((GLuint)entries, b + maxObjectEntries) - b;
-		std::vector<ObjectUniformData> uploadBuffer;
-		uploadBuffer.resize(toConsume);
-		for (int d = 0; d < toConsume; ++d)
-		{
-			auto& draw = list[b+d];
-			uploadBuffer[d] = {
-				draw.model,
-				glm::vec4(draw.drawInfo.colour.r/255.f,
-				draw.drawInfo.colour.g/255.f,
-				draw.drawInfo.colour.b/255.f, 1.f),
-				1.f,
-				1.f,
-				draw.drawInfo.colour.a/255.f
-			};
-		}
-		glBufferData(GL_UNIFORM_BUFFER,
-					 toConsume * sizeof(ObjectUniformData),
-					 uploadBuffer.data(),
-					 GL_STREAM_DRAW);
-
-		// Dispatch individual draws
-		for (int d = 0; d < toConsume; ++d)
-		{
-			auto& draw = list[b+d];
-			useDrawBuffer(draw.dbuff);
-
-			for( GLuint u = 0; u < draw.drawInfo.textures.size(); ++u )
-			{
-				useTexture(u, draw.drawInfo.textures[u]);
-			}
-
-			glDrawElements(draw.dbuff->getFaceType(), draw.drawInfo.count, GL_UNSIGNED_INT,
-                           reinterpret_cast<void*>(sizeof(RenderIndex) * draw.drawInfo.start));
-		}
-	}
-#else
-    for (auto& ri : list) {
-        draw(ri.model, ri.dbuff, ri.drawInfo);
+void OpenGLRenderer::drawInstances(DrawBuffer* draw,
+                                   const Renderer::DrawParameters& p,
+                                   GLuint firstObject, GLsizei instances) {
+    useDrawParameters(draw, p);
+    setObjectBase(firstObject);
+
+    glDrawElementsInstanced(
+        draw->getFaceType(), static_cast<GLsizei>(p.count), GL_UNSIGNED_INT,
+        reinterpret_cast<void*>(sizeof(RenderIndex) * p.start), instances);
+
+    drawCounter++;
+#ifdef RW_GRAPHICS_STATS
+    if (currentDebugDepth > 0) {
+        profileInfo[currentDebugDepth - 1].draws++;
+        profileInfo[currentDebugDepth - 1].primitives +=
+            p.count * static_cast<size_t>(instances);
+    }
+#endif
+}
+
+GLuint OpenGLRenderer::uploadObjects(const ObjectUniformData* objects,
+                                     size_t count) {
+    RW_ASSERT(count <= UBOObject.entryCount);
+    attachUBO(UBOObject.name);
+    if (UBOObject.currentEntry + count > UBOObject.entryCount) {
+        // Orphan the buffer, draws still using it keep the old storage
+        glBufferData(GL_UNIFORM_BUFFER, UBOObject.bufferSize, nullptr,
+                     GL_STREAM_DRAW);
+        UBOObject.currentEntry = 0;
+    }
+
+    const auto offset = UBOObject.currentEntry * UBOObject.entrySize;
+    const auto size = count * UBOObject.entrySize;
+    const auto flags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+                       GL_MAP_UNSYNCHRONIZED_BIT;
+    void* dst = glMapBufferRange(GL_UNIFORM_BUFFER, offset,
+                                 static_cast<GLsizeiptr>(size), flags);
+    RW_ASSERT(dst != nullptr);
+    memcpy(dst, objects, size);
+    glUnmapBuffer(GL_UNIFORM_BUFFER);
+
+    const auto firstObject = UBOObject.currentEntry;
+    UBOObject.currentEntry += static_cast<GLuint>(count);
+#ifdef RW_GRAPHICS_STATS
+    if (currentDebugDepth > 0) {
+        profileInfo[currentDebugDepth - 1].uploads++;
     }
 #endif
+    return firstObject;
 }
 
 void OpenGLRenderer::invalidate() {
@@ -377,13 +449,6 @@ bool OpenGLRenderer::createUBO(Buffer &out, GLsizei size, GLsizei entrySize)
     glBindBuffer(GL_UNIFORM_BUFFER, out.name);
     glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_STREAM_DRAW);
 
-    if (entrySize != size) {
-        GLint UBOAlignment;
-        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &UBOAlignment);
-        RW_ASSERT(UBOAlignment > 0);
-        entrySize = ((entrySize + (UBOAlignment-1))/UBOAlignment) * UBOAlignment;
-    }
-
     out.bufferSize = size;
     out.entrySize = entrySize;
     out.entryCount = size / entrySize;
@@ -393,29 +458,9 @@ bool OpenGLRenderer::createUBO(Buffer &out, GLsizei size, GLsizei entrySize)
 
 void OpenGLRenderer::uploadUBOEntry(Buffer &buffer, const void *data, size_t size)
 {
+    RW_ASSERT(buffer.entryCount == 1);
     attachUBO(buffer.name);
-    if (buffer.entryCount > 1) {
-        RW_ASSERT(size <= buffer.entrySize);
-        if (buffer.currentEntry >= buffer.entryCount) {
-            // Orphan the buffer, we don't want it anymore
-            glBufferData(GL_UNIFORM_BUFFER, buffer.bufferSize, nullptr,
-                         GL_STREAM_DRAW);
-            buffer.currentEntry = 0;
-        }
-        const auto offset = buffer.currentEntry * buffer.entrySize;
-        const auto flags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT
-                           | GL_MAP_UNSYNCHRONIZED_BIT;
-        void* dst = glMapBufferRange(GL_UNIFORM_BUFFER, offset,
-                                     buffer.entrySize, flags);
-        RW_ASSERT(dst != nullptr);
-        memcpy(dst, data, size);
-        glUnmapBuffer(GL_UNIFORM_BUFFER);
-        glBindBufferRange(GL_UNIFORM_BUFFER, kUBOIndexDraw, buffer.name, offset, size);
-        buffer.currentEntry++;
-    }
-    else {
-        glBufferData(GL_UNIFORM_BUFFER, size, data, GL_DYNAMIC_DRAW);
-    }
+    glBufferData(GL_UNIFORM_BUFFER, size, data, GL_DYNAMIC_DRAW);
 }
 
 void OpenGLRenderer::pushDebugGroup(const std::string& title) {
@@ -108,25 +108,76 @@ public:
     };
 
     /**
-     * @brief The RenderInstruction struct Generic Rendering instruction
+     * @brief The RenderList struct Generic Rendering instructions
      *
      * These are generated by the ObjectRenderer, and passed in to the
      * OpenGLRenderer by GameRenderer.
+     *
+     * Each draw is split across the keys, transformIndices and states arrays,
+     * so sorting only has to touch the keys. Matrices are stored once in
+     * transforms and shared by every draw of the same geometry. clear() keeps
+     * the storage, lists reused between frames stop allocating once they have
+     * grown to fit.
      */
-    struct RenderInstruction {
-        RenderKey sortKey;
-        // Ideally, this would just be an index into a buffer that contains the
-        // matrix
-        glm::mat4 model;
-        DrawBuffer* dbuff;
-        Renderer::DrawParameters drawInfo;
-
-        RenderInstruction(RenderKey key, const glm::mat4& model,
-                          DrawBuffer* dbuff, const Renderer::DrawParameters& dp)
-            : sortKey(key), model(model), dbuff(dbuff), drawInfo(dp) {
+    struct RenderList {
+        struct DrawState {
+            DrawBuffer* dbuff;
+            Renderer::DrawParameters drawInfo;
+        };
+
+        /// Sort key of each draw
+        std::vector<RenderKey> keys;
+        /// Index into transforms of each draw
+        std::vector<uint32_t> transformIndices;
+        /// Buffer and parameters of each draw
+        std::vector<DrawState> states;
+        /// Model matrices referenced by the draws
+        std::vector<glm::mat4> transforms;
+
+        size_t size() const {
+            return keys.size();
+        }
+
+        bool empty() const {
+            return keys.empty();
+        }
+
+        void clear() {
+            keys.clear();
+            transformIndices.clear();
+            states.clear();
+            transforms.clear();
+        }
+
+        /**
+         * @return The index to pass to add() to draw with this matrix
+         */
+        uint32_t addTransform(const glm::mat4& model) {
+            transforms.push_back(model);
+            return static_cast<uint32_t>(transforms.size() - 1);
         }
+
+        void add(RenderKey key, uint32_t transform, DrawBuffer* dbuff,
+                 const Renderer::DrawParameters& dp) {
+            keys.push_back(key);
+            transformIndices.push_back(transform);
+            states.push_back({dbuff, dp});
+        }
+
+        void add(RenderKey key, const glm::mat4& model, DrawBuffer* dbuff,
+                 const Renderer::DrawParameters& dp) {
+            add(key, addTransform(model), dbuff, dp);
+        }
+
+        const glm::mat4& getTransform(size_t draw) const {
+            return transforms[transformIndices[draw]];
+        }
+
+        /**
+         * @brief append Adds the draws of another list after these ones
+         */
+        void append(const RenderList& other);
     };
-    typedef std::vector<RenderInstruction> RenderList;
 
     struct ObjectUniformData {
         glm::mat4 model{1.0f};
@@ -134,8 +185,13 @@ public:
         float diffuse{};
         float ambient{};
         float visibility{};
+        /// Pads the struct to its std140 array stride
+        float padding{};
     };
 
+    /// Number of objects in the ObjectData block of the world shaders
+    static constexpr size_t kMaxBatchObjects = 128;
+
     struct SceneUniformData {
         glm::mat4 projection{1.0f};
         glm::mat4 view{1.0f};
@@ -189,7 +245,14 @@ public:
     virtual void drawArrays(const glm::mat4& model, DrawBuffer* draw,
                             const DrawParameters& p) = 0;
 
-    virtual void drawBatched(const RenderList& list) = 0;
+    /**
+     * @brief drawBatched Draws a sorted RenderList
+     *
+     * Object data is uploaded for up to kMaxBatchObjects draws at once.
+     * Consecutive draws of the same geometry with the same state are made
+     * with one instanced draw.
+     */
+    void drawBatched(const RenderList& list);
 
     void setViewport(const glm::ivec2& vp);
     const glm::ivec2& getViewport() const {
@@ -247,10 +310,28 @@ private:
     glm::mat4 projection2D{1.0f};
 
 protected:
+    /**
+     * @brief uploadObjects Stores object data for the following draws
+     * @return Index of the first object, to pass to drawInstances
+     */
+    virtual GLuint uploadObjects(const ObjectUniformData* objects,
+                                 size_t count) = 0;
+
+    /**
+     * @brief drawInstances Draws one instance for each object in
+     * [firstObject, firstObject + instances)
+     */
+    virtual void drawInstances(DrawBuffer* draw, const DrawParameters& p,
+                               GLuint firstObject, GLsizei instances) = 0;
+
     int drawCounter{};
     int textureCounter{};
     int bufferCounter{};
     SceneUniformData lastSceneData{};
+
+private:
+    /// Object data for the current batch, kept to reuse its storage
+    std::vector<ObjectUniformData> batchObjects;
 };
 
 class OpenGLRenderer final : public Renderer {
@@ -258,9 +339,13 @@ public:
     class OpenGLShaderProgram final : public ShaderProgram {
         GLuint program;
         std::map<std::string, GLint> uniforms;
+        /// Location of the index of the first object, -1 if unused
+        GLint objectBase;
 
     public:
-        OpenGLShaderProgram(GLuint p) : program(p) {
+        OpenGLShaderProgram(GLuint p)
+            : program(p)
+            , objectBase(glGetUniformLocation(p, "objectBase")) {
         }
 
         ~OpenGLShaderProgram() override {
@@ -271,6 +356,10 @@ public:
             return program;
         }
 
+        GLint getObjectBaseLocation() const {
+            return objectBase;
+        }
+
         GLint getUniformLocation(const std::string& name) {
             auto c = uniforms.find(name.c_str());
             GLint loc = -1;
@@ -321,14 +410,18 @@ public:
     void drawArrays(const glm::mat4& model, DrawBuffer* draw,
                     const DrawParameters& p) override;
 
-    void drawBatched(const RenderList& list) override;
-
     void invalidate() override;
 
     void pushDebugGroup(const std::string& title) override;
 
     const ProfileInfo& popDebugGroup() override;
 
+protected:
+    GLuint uploadObjects(const ObjectUniformData* objects,
+                         size_t count) override;
+    void drawInstances(DrawBuffer* draw, const DrawParameters& p,
+                       GLuint firstObject, GLsizei instances) override;
+
 private:
     struct Buffer {
         GLuint name{};
@@ -343,6 +436,11 @@ private:
 
     void useTexture(GLuint unit, GLuint tex);
 
+    /// Binds the buffer and textures and sets the blend and depth state
+    void useDrawParameters(DrawBuffer* draw, const DrawParameters& p);
+
+    void setObjectBase(GLuint firstObject);
+
     Buffer UBOObject {};
     Buffer UBOScene {};
 
@@ -0,0 +1,118 @@
+#include "render/RenderSort.hpp"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include <gl/DrawBuffer.hpp>
+
+namespace {
+constexpr unsigned int kDepthBits = 24;
+constexpr RenderKey kDepthMax = (RenderKey{1} << kDepthBits) - 1;
+constexpr RenderKey kStateMask = 0xFFFF;
+
+constexpr unsigned int kDigitBits = 8;
+constexpr size_t kBuckets = size_t{1} << kDigitBits;
+constexpr size_t kPasses = sizeof(RenderKey) * 8 / kDigitBits;
+
+RenderKey quantizeDepth(float depth) {
+    // Also catches NaN
+    if (!(depth > 0.f)) {
+        return 0;
+    }
+    if (depth >= 1.f) {
+        return kDepthMax;
+    }
+    return static_cast<RenderKey>(depth * static_cast<float>(kDepthMax));
+}
+}  // namespace
+
+RenderKey createRenderKey(const Renderer::DrawParameters& dp,
+                          const DrawBuffer* dbuff, float normalizedDepth) {
+    const RenderKey noDepthWrite = dp.depthWrite ? 0 : 1;
+    const RenderKey texture = dp.textures[0] & kStateMask;
+    const RenderKey buffer = dbuff ? (dbuff->getVAOName() & kStateMask) : 0;
+    const RenderKey depth = quantizeDepth(normalizedDepth);
+
+    if (dp.blendMode == BlendMode::BLEND_NONE) {
+        return noDepthWrite << 62 | texture << 46 | buffer << 30 | depth << 6;
+    }
+    return RenderKey{1} << 63 | (kDepthMax - depth) << 39 | noDepthWrite << 38 |
+           texture << 22 | buffer << 6;
+}
+
+void radixSort(std::vector<RenderSortEntry>& entries,
+               std::vector<RenderSortEntry>& scratch) {
+    const size_t count = entries.size();
+    if (count < 2) {
+        return;
+    }
+
+    // Count every digit in one pass over the keys
+    std::array<std::array<size_t, kBuckets>, kPasses> histograms{};
+    for (const auto& entry : entries) {
+        for (size_t pass = 0; pass < kPasses; ++pass) {
+            ++histograms[pass][(entry.key >> (pass * kDigitBits)) &
+                               (kBuckets - 1)];
+        }
+    }
+
+    scratch.resize(count);
+    auto* source = &entries;
+    auto* destination = &scratch;
+
+    for (size_t pass = 0; pass < kPasses; ++pass) {
+        const auto shift = pass * kDigitBits;
+        auto& histogram = histograms[pass];
+
+        // Skip digits that are the same in every key
+        if (histogram[(source->front().key >> shift) & (kBuckets - 1)] ==
+            count) {
+            continue;
+        }
+
+        std::array<size_t, kBuckets> offsets;
+        size_t offset = 0;
+        for (size_t b = 0; b < kBuckets; ++b) {
+            offsets[b] = offset;
+            offset += histogram[b];
+        }
+
+        for (const auto& entry : *source) {
+            const auto digit = (entry.key >> shift) & (kBuckets - 1);
+            (*destination)[offsets[digit]++] = entry;
+        }
+        std::swap(source, destination);
+    }
+
+    if (source != &entries) {
+        entries.swap(scratch);
+    }
+}
+
+void RenderListSorter::sort(RenderList& list) {
+    const size_t count = list.size();
+    entries.clear();
+    entries.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        entries.push_back({list.keys[i], static_cast<uint32_t>(i)});
+    }
+
+    radixSort(entries, scratch);
+
+    keys.clear();
+    transformIndices.clear();
+    states.clear();
+    keys.reserve(count);
+    transformIndices.reserve(count);
+    states.reserve(count);
+    for (const auto& entry : entries) {
+        keys.push_back(entry.key);
+        transformIndices.push_back(list.transformIndices[entry.index]);
+        states.push_back(list.states[entry.index]);
+    }
+
+    list.keys.swap(keys);
+    list.transformIndices.swap(transformIndices);
+    list.states.swap(states);
+}
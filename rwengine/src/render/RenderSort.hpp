@@ -0,0 +1,63 @@
+#ifndef _RWENGINE_RENDERSORT_HPP_
+#define _RWENGINE_RENDERSORT_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <render/OpenGLRenderer.hpp>
+
+/**
+ * @brief createRenderKey Builds the key that orders draws in a RenderList
+ *
+ * Draws are sorted by ascending key. Opaque draws come first, grouped by
+ * depth writes, texture and DrawBuffer so consecutive draws share state,
+ * then ordered front to back. Blended draws follow, ordered back to front.
+ *
+ * Bit layout, most significant first:
+ *   opaque:  0 | no depth write | texture:16 | buffer:16 | depth:24
+ *   blended: 1 | inverse depth:24 | no depth write | texture:16 | buffer:16
+ *
+ * The renderer uses one program for all objects, so there are no program
+ * bits in the key.
+ *
+ * @param normalizedDepth depth between the near (0) and far (1) planes
+ */
+RenderKey createRenderKey(const Renderer::DrawParameters& dp,
+                          const DrawBuffer* dbuff, float normalizedDepth);
+
+/**
+ * @brief Position of a draw in a RenderList, with its key
+ */
+struct RenderSortEntry {
+    RenderKey key;
+    uint32_t index;
+};
+
+/**
+ * @brief radixSort Sorts entries by key, keeping the order of equal keys
+ * @param scratch temporary storage, kept by the caller so it can be reused
+ */
+void radixSort(std::vector<RenderSortEntry>& entries,
+               std::vector<RenderSortEntry>& scratch);
+
+/**
+ * @brief Sorts RenderLists by key, keeping storage between sorts
+ *
+ * Keys are radix sorted along with their index, then the per-draw arrays are
+ * gathered into that order. Transforms aren't moved, draws keep pointing at
+ * the same matrices.
+ */
+class RenderListSorter {
+public:
+    void sort(RenderList& list);
+
+private:
+    std::vector<RenderSortEntry> entries;
+    std::vector<RenderSortEntry> scratch;
+
+    std::vector<RenderKey> keys;
+    std::vector<uint32_t> transformIndices;
+    std::vector<RenderList::DrawState> states;
+};
+
+#endif
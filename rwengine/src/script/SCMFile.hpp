@@ -35,6 +35,10 @@ public:
         return _data.get();
     }
 
+    size_t getSize() const {
+        return _size;
+    }
+
     template <class T>
     T read(unsigned int offset) const {
         return bit_cast<T>(*(_data.get() + offset));
@@ -74,6 +78,7 @@ public:
 
 private:
     std::unique_ptr<SCMByte[]> _data;
+    size_t _size{0};
 
     SCMTarget _target{NoTarget};
 
@@ -12,8 +12,131 @@
 #include "script/SCMFile.hpp"
 #include "script/ScriptModule.hpp"
 
+uint32_t ScriptMachine::decodeInstruction(SCMAddress pc, const char* thread) {
+    // Without a thread the caller is guessing that pc is code, so anything
+    // odd is an error rather than something to log
+    const bool speculative = thread == nullptr;
+    const auto threadName = speculative ? "" : thread;
+    const auto size = file.getSize();
+
+    if (pc + sizeof(SCMOpcode) > size) {
+        throw IllegalInstruction(0, pc, threadName);
+    }
+    auto opcode = file.read<SCMOpcode>(pc);
+
+    SCMInstruction instruction;
+    instruction.isNegatedConditional =
+        ((opcode & SCM_NEGATE_CONDITIONAL_MASK) == SCM_NEGATE_CONDITIONAL_MASK);
+    instruction.opcode =
+        static_cast<SCMOpcode>(opcode & ~SCM_NEGATE_CONDITIONAL_MASK);
+
+    if (!module->findOpcode(instruction.opcode, &instruction.function)) {
+        throw IllegalInstruction(instruction.opcode, pc, threadName);
+    }
+    const auto& code = *instruction.function;
+
+    auto cursor = pc + sizeof(SCMOpcode);
+    auto readValue = [&](auto value) {
+        if (cursor + sizeof(value) > size) {
+            throw IllegalInstruction(instruction.opcode, pc, threadName);
+        }
+        value = file.read<decltype(value)>(static_cast<unsigned int>(cursor));
+        cursor += sizeof(value);
+        return value;
+    };
+    auto variableOutOfBounds = [&](const std::string& message) {
+        if (speculative) {
+            throw IllegalInstruction(instruction.opcode, pc, threadName);
+        }
+        state->world->logger->error("SCM", message);
+    };
+
+    SCMParams decoded;
+
+    bool hasExtraParameters = code.arguments < 0;
+    auto requiredParams = std::abs(code.arguments);
+
+    for (int p = 0; p < requiredParams || hasExtraParameters; ++p) {
+        if (cursor >= size) {
+            throw IllegalInstruction(instruction.opcode, pc, threadName);
+        }
+        auto type_r = file.read<SCMByte>(static_cast<unsigned int>(cursor));
+        auto type = static_cast<SCMType>(type_r);
+
+        if (type_r > 42) {
+            // for implicit strings, we need the byte we just read.
+            type = TString;
+        } else {
+            cursor += sizeof(SCMByte);
+        }
+
+        decoded.push_back(SCMOpcodeParameter{type, {0}});
+        auto& parameter = decoded.back();
+        switch (type) {
+            case EndOfArgList:
+                hasExtraParameters = false;
+                break;
+            case TInt8:
+                parameter.integer = readValue(std::int8_t{});
+                break;
+            case TInt16:
+                parameter.integer = readValue(std::int16_t{});
+                break;
+            case TGlobal: {
+                auto v = readValue(std::uint16_t{});
+                parameter.integer = v;  //* SCM_VARIABLE_SIZE;
+                if (v >= file.getGlobalsSize()) {
+                    variableOutOfBounds(
+                        "Global Out of bounds! " + std::to_string(v) + " " +
+                        std::to_string(file.getGlobalsSize()));
+                }
+            } break;
+            case TLocal: {
+                auto v = readValue(std::uint16_t{});
+                parameter.integer = v * SCM_VARIABLE_SIZE;
+                if (v >= SCM_THREAD_LOCAL_SIZE) {
+                    variableOutOfBounds("Local Out of bounds!");
+                }
+            } break;
+            case TInt32:
+                parameter.integer = readValue(std::int32_t{});
+                break;
+            case TString:
+                if (cursor + 8 > size) {
+                    throw IllegalInstruction(instruction.opcode, pc,
+                                             threadName);
+                }
+                std::copy(file.data() + cursor, file.data() + cursor + 8,
+                          parameter.string);
+                cursor += sizeof(SCMByte) * 8;
+                break;
+            case TFloat16:
+                parameter.real = readValue(std::int16_t{}) / 16.f;
+                break;
+            default:
+                throw UnknownType(type, pc, threadName);
+                break;
+        };
+    }
+
+    instruction.next = static_cast<SCMAddress>(cursor);
+    instruction.firstParameter =
+        static_cast<uint32_t>(decodedParameters.size());
+    instruction.parameterCount = static_cast<uint32_t>(decoded.size());
+    decodedParameters.insert(decodedParameters.end(), decoded.begin(),
+                             decoded.end());
+
+    const auto index = static_cast<uint32_t>(instructions.size());
+    instructions.push_back(instruction);
+    if (pc < instructionIndex.size()) {
+        instructionIndex[pc] = static_cast<int32_t>(index);
+    }
+    return index;
+}
+
 void ScriptMachine::executeThread(SCMThread& t, int msPassed) {
-    auto player = state->world->getPlayer();
+    // Scripts can run without a world in the tests
+    auto player = state->world ? state->world->getPlayer() : nullptr;
 
     if (player) {
         if (t.isMission && t.deathOrArrestCheck &&
@@ -36,90 +159,19 @@ void ScriptMachine::executeThread(SCMThread& t, int msPassed) {
     if (t.wakeCounter > 0) return;
 
     while (t.wakeCounter == 0) {
-        auto pc = t.programCounter;
-        auto opcode = file.read<SCMOpcode>(pc);
-
-        bool isNegatedConditional = ((opcode & SCM_NEGATE_CONDITIONAL_MASK) ==
-                                     SCM_NEGATE_CONDITIONAL_MASK);
-        opcode = opcode & ~SCM_NEGATE_CONDITIONAL_MASK;
-
-        ScriptFunctionMeta* foundcode;
-        if (!module->findOpcode(opcode, &foundcode)) {
-            throw IllegalInstruction(opcode, pc, t.name);
-        }
-        ScriptFunctionMeta& code = *foundcode;
+        const auto instruction = getInstruction(t.programCounter, t.name);
+        ScriptFunctionMeta& code = *instruction.function;
 
-        pc += sizeof(SCMOpcode);
-
-        SCMParams parameters;
-
-        bool hasExtraParameters = code.arguments < 0;
-        auto requiredParams = std::abs(code.arguments);
-
-        for (int p = 0; p < requiredParams || hasExtraParameters; ++p) {
-            auto type_r = file.read<SCMByte>(pc);
-            auto type = static_cast<SCMType>(type_r);
-
-            if (type_r > 42) {
-                // for implicit strings, we need the byte we just read.
-                type = TString;
-            } else {
-                pc += sizeof(SCMByte);
+        // Variables are stored as offsets, point them at this thread's memory
+        const auto decoded =
+            decodedParameters.begin() + instruction.firstParameter;
+        parameters.assign(decoded, decoded + instruction.parameterCount);
+        for (auto& parameter : parameters) {
+            if (parameter.type == TGlobal) {
+                parameter.globalPtr = globalData.data() + parameter.integer;
+            } else if (parameter.type == TLocal) {
+                parameter.globalPtr = t.locals.data() + parameter.integer;
             }
-
-            parameters.push_back(SCMOpcodeParameter{type, {0}});
-            switch (type) {
-                case EndOfArgList:
-                    hasExtraParameters = false;
-                    break;
-                case TInt8:
-                    parameters.back().integer = file.read<std::int8_t>(pc);
-                    pc += sizeof(SCMByte);
-                    break;
-                case TInt16:
-                    parameters.back().integer = file.read<std::int16_t>(pc);
-                    pc += sizeof(SCMByte) * 2;
-                    break;
-                case TGlobal: {
-                    auto v = file.read<std::uint16_t>(pc);
-                    parameters.back().globalPtr =
-                        globalData.data() + v;  //* SCM_VARIABLE_SIZE;
-                    if (v >= file.getGlobalsSize()) {
-                        state->world->logger->error(
-                            "SCM", "Global Out of bounds! " +
-                                       std::to_string(v) + " " +
-                                       std::to_string(file.getGlobalsSize()));
-                    }
-                    pc += sizeof(SCMByte) * 2;
-                } break;
-                case TLocal: {
-                    auto v = file.read<std::uint16_t>(pc);
-                    parameters.back().globalPtr =
-                        t.locals.data() + v * SCM_VARIABLE_SIZE;
-                    if (v >= SCM_THREAD_LOCAL_SIZE) {
-                        state->world->logger->error("SCM",
-                                                    "Local Out of bounds!");
-                    }
-                    pc += sizeof(SCMByte) * 2;
-                } break;
-                case TInt32:
-                    parameters.back().integer = file.read<std::int32_t>(pc);
-                    pc += sizeof(SCMByte) * 4;
-                    break;
-                case TString:
-                    std::copy(file.data() + pc, file.data() + pc + 8,
-                              parameters.back().string);
-                    pc += sizeof(SCMByte) * 8;
-                    break;
-                case TFloat16:
-                    parameters.back().real =
-                        file.read<std::int16_t>(pc) / 16.f;
-                    pc += sizeof(SCMByte) * 2;
-                    break;
-                default:
-                    throw UnknownType(type, pc, t.name);
-                    break;
-            };
         }
 
         ScriptArguments sca(&parameters, &t, this);
@@ -128,7 +180,8 @@ void ScriptMachine::executeThread(SCMThread& t, int msPassed) {
         static auto sDebugThreadName = getenv("OPENRW_DEBUG_THREAD");
         if (!sDebugThreadName || strncmp(t.name, sDebugThreadName, 8) == 0) {
             printf("%8s %01x %06x %04x %s", t.name, t.conditionResult,
-                   t.programCounter, opcode, code.signature.c_str());
+                   t.programCounter, instruction.opcode,
+                   code.signature.c_str());
             for (auto& a : sca.getParameters()) {
                 if (a.type == SCMType::TString) {
                     printf(" %1x:'%s'", a.type, a.string);
@@ -143,22 +196,19 @@ void ScriptMachine::executeThread(SCMThread& t, int msPassed) {
 #endif
 
         // After debugging has been completed, update the program counter
-        t.programCounter = pc;
+        t.programCounter = instruction.next;
 
         if (code.function) {
             code.function(sca);
         }
 
-        if (isNegatedConditional) {
+        if (instruction.isNegatedConditional) {
             t.conditionResult = !t.conditionResult;
         }
 
         // Handle conditional results for IF statements.
-        if (t.conditionCount > 0 && opcode != 0x00D6)  /// @todo add conditional
-                                                       /// flag to opcodes
-                                                       /// instead of checking
-                                                       /// for 0x00D6
-        {
+        /// @todo add conditional flag to opcodes instead of checking for 0x00D6
+        if (t.conditionCount > 0 && instruction.opcode != 0x00D6) {
             --t.conditionCount;
             if (t.conditionAND) {
                 if (t.conditionResult == false) {
@@ -199,6 +249,17 @@ ScriptMachine::ScriptMachine(GameState* _state, SCMFile& file,
     auto offset = file.getGlobalSection();
     std::copy(file.data() + offset, file.data() + offset + size,
               globalData.begin());
+
+    // Decode the code section up front. It is all instructions in the game's
+    // scripts, but if something else turns up the rest of the section is
+    // left to be decoded as threads reach it.
+    instructionIndex.resize(file.getSize(), -1);
+    try {
+        for (SCMAddress pc = file.getCodeSection(); pc < file.getSize();) {
+            pc = instructions[decodeInstruction(pc, nullptr)].next;
+        }
+    } catch (SCMException&) {
+    }
 }
 
 void ScriptMachine::startThread(SCMThread::pc_t start, bool mission) {
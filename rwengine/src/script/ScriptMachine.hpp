@@ -105,6 +105,24 @@ struct SCMThread {
     bool allowWaitSkip;
 };
 
+/**
+ * @brief An instruction decoded from the script file
+ *
+ * Arguments are parsed when the instruction is decoded. Variables are kept as
+ * byte offsets into the globals or the thread's locals, the rest are ready to
+ * use.
+ */
+struct SCMInstruction {
+    ScriptFunctionMeta* function;
+    SCMOpcode opcode;
+    bool isNegatedConditional;
+    /// Address of the following instruction
+    SCMAddress next;
+    /// Range of the arguments in the machine's decoded parameters
+    uint32_t firstParameter;
+    uint32_t parameterCount;
+};
+
 /**
  * Implements the actual fetch-execute mechanism for the game script virtual
  * machine.
@@ -126,6 +144,10 @@ struct SCMThread {
  * by consuming the correct number of arguments, allowing the next instruction
  * to be found,
  * and then dispatching a call to the opcode's function.
+ *
+ * Instructions are decoded once and kept by address. The code section is
+ * decoded when the machine is created, anything else the first time a thread
+ * reaches it.
  */
 class ScriptMachine {
 public:
@@ -193,8 +215,29 @@ private:
 
     void executeThread(SCMThread& t, int msPassed);
 
+    /**
+     * @brief decodeInstruction Decodes and stores the instruction at pc
+     * @return Index of the instruction in instructions
+     */
+    uint32_t decodeInstruction(SCMAddress pc, const char* thread);
+
+    const SCMInstruction& getInstruction(SCMAddress pc, const char* thread) {
+        if (pc < instructionIndex.size() && instructionIndex[pc] >= 0) {
+            return instructions[static_cast<size_t>(instructionIndex[pc])];
+        }
+        return instructions[decodeInstruction(pc, thread)];
+    }
+
     std::vector<SCMByte> globalData;
 
+    std::vector<SCMInstruction> instructions;
+    /// Index into instructions for each address of the file, or -1
+    std::vector<int32_t> instructionIndex;
+    /// Arguments of every decoded instruction
+    SCMParams decodedParameters;
+    /// Arguments of the executing instruction, reused between instructions
+    SCMParams parameters;
+
     std::mt19937 randomNumberGen;
 };
 
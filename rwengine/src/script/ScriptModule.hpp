@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <map>
+#include <vector>
 
 #include <script/ScriptTypes.hpp>
 #include "ScriptMachine.hpp"
@@ -163,11 +164,16 @@ public:
 
     template <class Tfunc>
     void bind(ScriptFunctionID id, int argc, Tfunc function) {
-        functions.insert({id,
-                          {[=](const ScriptArguments& args) {
-                               script_bind::do_unpacked_call(function, args);
-                           },
-                           argc, "opcode", ""}});
+        auto result = functions.insert(
+            {id,
+             {[=](const ScriptArguments& args) {
+                  script_bind::do_unpacked_call(function, args);
+              },
+              argc, "opcode", ""}});
+        if (id >= opcodeTable.size()) {
+            opcodeTable.resize(id + 1u, nullptr);
+        }
+        opcodeTable[id] = &result.first->second;
     }
 
     bool findOpcode(ScriptFunctionID id, ScriptFunctionMeta** out);
@@ -175,6 +181,8 @@ public:
 private:
     const std::string name;
     std::map<ScriptFunctionID, ScriptFunctionMeta> functions;
+    /// Every bound function indexed by opcode, for lookups without searching
+    std::vector<ScriptFunctionMeta*> opcodeTable;
 };
 
 #endif
@@ -7,6 +7,7 @@
 #include "engine/GameState.hpp"
 #include "engine/GameWorld.hpp"
 #include "objects/CharacterObject.hpp"
+#include "objects/CutsceneObject.hpp"
 #include "objects/InstanceObject.hpp"
 #include "objects/PickupObject.hpp"
 #include "objects/VehicleObject.hpp"
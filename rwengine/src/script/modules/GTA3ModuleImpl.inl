@@ -7441,8 +7441,8 @@ void opcode_02c5(const ScriptArguments& args, ScriptInt& collected) {
     opcode 02c6
 */
 void opcode_02c6(const ScriptArguments& args) {
-    for (auto& p : args.getWorld()->pickupPool.objects) {
-        auto pickup = static_cast<BigNVeinyPickup*>(p.second.get());
+    for (auto p : args.getWorld()->pickupPool) {
+        auto pickup = static_cast<BigNVeinyPickup*>(p);
         if (pickup->isBigNVeinyPickup()) {
             script::destroyObject(args, pickup);
         }
@@ -7719,8 +7719,7 @@ void opcode_02dd(const ScriptArguments& args, const ScriptString areaName, Scrip
     if (zone) {
         // Create a list of candidate characters by iterating and checking if the char is in this zone
         std::vector<std::pair<GameObjectID, GameObject*>> candidates;
-        for (auto& [id, pedestrianPtr] : args.getWorld()->pedestrianPool.objects) {
-            auto character = static_cast<CharacterObject*>(pedestrianPtr.get());
+        for (auto character : args.getWorld()->pedestrianPool) {
 
             // We only consider characters walking around normally
             // @todo not sure if we are able to grab script objects or players too
@@ -7735,7 +7734,8 @@ void opcode_02dd(const ScriptArguments& args, const ScriptString areaName, Scrip
             auto& max = zone->max;
             if (cp.x > min.x && cp.y > min.y && cp.z > min.z &&
                 cp.x < max.x && cp.y < max.y && cp.z < max.z) {
-                candidates.emplace_back(id, pedestrianPtr.get());
+                candidates.emplace_back(character->getGameObjectID(),
+                                        character);
             }
         }
 
@@ -9053,31 +9053,23 @@ bool opcode_0339(const ScriptArguments& args, ScriptVec3 coord0, ScriptVec3 coor
     if (solids) {
     	RW_UNIMPLEMENTED("0x339: solid flag");
     }
+    uint32_t types = 0;
     if (actors) {
-    	auto& actors = args.getWorld()->pedestrianPool.objects;
-    	for (const auto& o : actors) {
-                if (script::objectInBounds(o.second.get(), coord0, coord1)) {
-    			return true;
-    		}
-    	}
+        types |= GameObject::typeMask(GameObject::Character);
     }
     if (cars) {
-    	auto& cars = args.getWorld()->vehiclePool.objects;
-    	for (const auto& o : cars) {
-                if (script::objectInBounds(o.second.get(), coord0, coord1)) {
-    			return true;
-    		}
-    	}
+        types |= GameObject::typeMask(GameObject::Vehicle);
     }
     if (objects) {
-    	auto& objects = args.getWorld()->instancePool.objects;
-    	for (const auto& o : objects) {
-                if (script::objectInBounds(o.second.get(), coord0, coord1)) {
-    			return true;
-    		}
-    	}
+        types |= GameObject::typeMask(GameObject::Instance);
     }
-    return false;
+    if (types == 0) {
+        return false;
+    }
+
+    std::vector<GameObject*> found;
+    args.getWorld()->findObjectsInBox(coord0, coord1, types, found);
+    return !found.empty();
 }
 
 /**
@@ -9621,8 +9613,7 @@ void opcode_0363(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloa
     // Attempt to find the closest object
     InstanceObject* closestObject = nullptr;
     float closestDistance = radius;
-    for(auto& i : args.getWorld()->instancePool.objects) {
-        InstanceObject* object = static_cast<InstanceObject*>(i.second.get());
+    for(auto object : args.getWorld()->instancePool) {
 
     	// Check if this instance has the correct model id, early out if it isn't
     	auto modelinfo = object->getModelInfo<BaseModelInfo>();
@@ -10887,14 +10878,13 @@ void opcode_03b6(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloa
     auto newobjectid = args.getWorld()->data->findModelObject(newmodel);
     auto nobj = args.getWorld()->data->findModelInfo<SimpleModelInfo>(newobjectid);
 
-    for(auto& p : args.getWorld()->instancePool.objects) {
-        auto o = p.second.get();
-    	if( !o->getModel() ) continue;
-    	if( o->getModelInfo<BaseModelInfo>()->name != oldmodel ) continue;
+    for(auto o : args.getWorld()->instancePool) {
+    	// Streamed instances may not have their model loaded yet
+    	auto modelinfo = o->getModelInfo<BaseModelInfo>();
+    	if( !modelinfo || modelinfo->name != oldmodel ) continue;
     	float d = glm::distance(coord, o->getPosition());
     	if( d < radius ) {
-    		InstanceObject* inst = static_cast<InstanceObject*>(o);
-    		inst->changeModel(nobj);
+    		o->changeModel(nobj);
     	}
     }
 }
@@ -0,0 +1,58 @@
+#include "FrameStats.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include <rw/debug.hpp>
+
+namespace {
+float nearestRank(std::vector<float>& values, float percentile) {
+    auto rank = static_cast<size_t>(
+        std::ceil(percentile * static_cast<float>(values.size())));
+    auto index = rank > 0 ? rank - 1 : 0;
+    auto nth = values.begin() + static_cast<std::ptrdiff_t>(index);
+    std::nth_element(values.begin(), nth, values.end());
+    return *nth;
+}
+}  // namespace
+
+FrameTimeRecorder::FrameTimeRecorder(size_t capacity)
+    : times(capacity), sorted(capacity) {
+    RW_ASSERT(capacity > 0);
+}
+
+void FrameTimeRecorder::record(float frameTime) {
+    times[next] = frameTime;
+    next = (next + 1) % times.size();
+    ++recorded;
+}
+
+void FrameTimeRecorder::clear() {
+    next = 0;
+    recorded = 0;
+}
+
+FrameTimeSummary FrameTimeRecorder::summarize() const {
+    FrameTimeSummary summary;
+    summary.frames = size();
+    if (summary.frames == 0) {
+        return summary;
+    }
+
+    sorted.assign(times.begin(),
+                  times.begin() + static_cast<std::ptrdiff_t>(summary.frames));
+
+    const double total = std::accumulate(sorted.begin(), sorted.end(), 0.);
+    summary.mean = static_cast<float>(total / summary.frames);
+    summary.max = *std::max_element(sorted.begin(), sorted.end());
+    summary.hitches = static_cast<size_t>(
+        std::count_if(sorted.begin(), sorted.end(),
+                      [](float t) { return t > kHitchFrameTime; }));
+
+    summary.p50 = nearestRank(sorted, 0.50f);
+    summary.p90 = nearestRank(sorted, 0.90f);
+    summary.p99 = nearestRank(sorted, 0.99f);
+
+    return summary;
+}
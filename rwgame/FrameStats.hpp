@@ -0,0 +1,67 @@
+#ifndef RWGAME_FRAMESTATS_HPP
+#define RWGAME_FRAMESTATS_HPP
+
+#include <cstddef>
+#include <vector>
+
+/// Frames slower than this (in seconds) are counted as hitches
+constexpr float kHitchFrameTime = 1.f / 30.f;
+
+/**
+ * @brief Distribution of a set of frame times, in seconds
+ */
+struct FrameTimeSummary {
+    size_t frames = 0;
+    float mean = 0.f;
+    float p50 = 0.f;
+    float p90 = 0.f;
+    float p99 = 0.f;
+    float max = 0.f;
+    size_t hitches = 0;
+};
+
+/**
+ * @brief Records frame times into a fixed size ring
+ *
+ * The storage is allocated up front so recording never allocates during a
+ * run. Once the ring is full the oldest frames are overwritten and the
+ * summary only covers the most recent capacity() frames.
+ */
+class FrameTimeRecorder {
+public:
+    explicit FrameTimeRecorder(size_t capacity);
+
+    void record(float frameTime);
+
+    void clear();
+
+    /**
+     * @brief summarize Computes percentiles over the stored frames
+     *
+     * Percentiles use the nearest rank, so they are always one of the
+     * recorded frame times.
+     */
+    FrameTimeSummary summarize() const;
+
+    size_t capacity() const {
+        return times.size();
+    }
+
+    /// Number of frames available to summarize()
+    size_t size() const {
+        return recorded < times.size() ? recorded : times.size();
+    }
+
+    /// Number of frames recorded since the last clear, including overwritten
+    size_t getRecordedCount() const {
+        return recorded;
+    }
+
+private:
+    std::vector<float> times;
+    size_t next = 0;
+    size_t recorded = 0;
+    mutable std::vector<float> sorted;
+};
+
+#endif
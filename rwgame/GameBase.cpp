@@ -42,7 +42,10 @@ GameBase::GameBase(Logger &inlog, int argc, char *argv[]) :
     po::options_description desc_devel("Developer options");
     desc_devel.add_options()(
         "test,t", "Starts a new game in a test location")(
-        "benchmark,b", po::value<std::string>()->value_name("PATH"), "Run benchmark from file");
+        "benchmark,b", po::value<std::string>()->value_name("PATH"), "Run benchmark from file")(
+        "benchmark-runs", po::value<unsigned int>()->value_name("N")->default_value(1), "Number of times to run the benchmark")(
+        "benchmark-warmup", po::value<float>()->value_name("SECONDS")->default_value(2.f), "Time at the start of each run to leave out of the results")(
+        "benchmark-output", po::value<std::string>()->value_name("PATH"), "Write benchmark results to a .json or .csv file");
     po::options_description desc("Generic options");
     desc.add_options()(
         "config,c", po::value<rwfs::path>()->value_name("PATH"), "Path of configuration file")(
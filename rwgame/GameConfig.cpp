@@ -255,6 +255,7 @@ GameConfig::ParseResult GameConfig::parseConfig(GameConfig::ParseType srcType,
                 patht, false);
     read_config("game.language", this->m_gameLanguage, "american", deft);
     read_config("game.hud_scale", this->m_HUDscale, 1.f, floatt);
+    read_config("game.asset_cache", this->m_assetCachePath, "", patht);
 
     read_config("input.invert_y", this->m_inputInvertY, false, boolt);
 
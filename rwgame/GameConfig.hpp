@@ -234,6 +234,9 @@ public:
     float getHUDScale() const {
         return m_HUDscale;
     }
+    const rwfs::path &getAssetCachePath() const {
+        return m_assetCachePath;
+    }
 
     static rwfs::path getDefaultConfigPath();
 private:
@@ -263,6 +266,9 @@ private:
     /// Path to the game data
     rwfs::path m_gamePath;
 
+    /// Directory for baked asset data, empty to disable the cache
+    rwfs::path m_assetCachePath;
+
     /// Language for game
     std::string m_gameLanguage = "american";
 
@@ -21,9 +21,9 @@
 #include <objects/VehicleObject.hpp>
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <algorithm>
 #include <functional>
 #include <iomanip>
-#include <iostream>
 
 namespace {
 static constexpr std::array<
@@ -31,8 +31,6 @@ static constexpr std::array<
     kSpecialModels{{{GameRenderer::ZoneCylinderA, "zonecyla.dff", "particle"},
                     {GameRenderer::ZoneCylinderB, "zonecylb.dff", "particle"},
                     {GameRenderer::Arrow, "arrow.dff", ""}}};
-
-constexpr float kMaxPhysicsSubSteps = 2;
 }  // namespace
 
 #define MOUSE_SENSITIVITY_SCALE 2.5f
@@ -40,7 +38,7 @@ constexpr float kMaxPhysicsSubSteps = 2;
 RWGame::RWGame(Logger& log, int argc, char* argv[])
     : GameBase(log, argc, argv)
     , data(&log, config.getGameDataPath())
-    , renderer(&log, &data) {
+    , renderer(&log, &data, &jobs) {
     RW_PROFILE_THREAD("Main");
     RW_TIMELINE_ENTER("Startup", MP_YELLOW);
 
@@ -48,9 +46,17 @@ RWGame::RWGame(Logger& log, int argc, char* argv[])
     bool test = options.count("test");
     std::string startSave(
         options.count("load") ? options["load"].as<std::string>() : "");
-    std::string benchFile(options.count("benchmark")
-                              ? options["benchmark"].as<std::string>()
-                              : "");
+    BenchmarkSettings benchmark;
+    if (options.count("benchmark")) {
+        benchmark.trackFile = options["benchmark"].as<std::string>();
+        benchmark.runs =
+            std::max(options["benchmark-runs"].as<unsigned int>(), 1u);
+        benchmark.warmupTime = options["benchmark-warmup"].as<float>();
+        if (options.count("benchmark-output")) {
+            benchmark.outputPath =
+                options["benchmark-output"].as<std::string>();
+        }
+    }
 
     log.info("Game", "Game directory: " + config.getGameDataPath().string());
 
@@ -59,6 +65,11 @@ RWGame::RWGame(Logger& log, int argc, char* argv[])
                                  config.getGameDataPath().string());
     }
 
+    if (!config.getAssetCachePath().empty()) {
+        log.info("Game", "Asset cache: " + config.getAssetCachePath().string());
+        data.assetCache = AssetCache(config.getAssetCachePath());
+    }
+
     data.load();
 
     for (const auto& [specialModel, fileName, name] : kSpecialModels) {
@@ -94,8 +105,8 @@ RWGame::RWGame(Logger& log, int argc, char* argv[])
     }
 
     StateManager::get().enter<LoadingState>(this, [=]() {
-        if (!benchFile.empty()) {
-            StateManager::get().enter<BenchmarkState>(this, benchFile);
+        if (!benchmark.trackFile.empty()) {
+            StateManager::get().enter<BenchmarkState>(this, benchmark);
         } else if (test) {
             StateManager::get().enter<IngameState>(this, true, "test");
         } else if (newgame) {
@@ -120,7 +131,7 @@ void RWGame::newGame() {
     state = GameState();
 
     // Destroy the current world and start over
-    world = std::make_unique<GameWorld>(&log, &data);
+    world = std::make_unique<GameWorld>(&log, &data, &jobs);
     world->dynamicsWorld->setDebugDrawer(&debug);
 
     // Associate the new world with the new state and vice versa
@@ -414,11 +425,7 @@ float RWGame::tickWorld(const float deltaTime, float accumulatedTime) {
             break;
         }
 
-        {
-            RW_PROFILE_SCOPEC("stepSimulation", MP_DARKORANGE1);
-            world->dynamicsWorld->stepSimulation(
-                    deltaTimeWithTimeScale, kMaxPhysicsSubSteps, deltaTime);
-        }
+        world->stepPhysics(deltaTimeWithTimeScale, deltaTime);
 
         StateManager::get().tick(deltaTimeWithTimeScale);
 
@@ -475,111 +482,11 @@ void RWGame::tick(float dt) {
     RW_PROFILE_SCOPE(__func__);
     State* currState = StateManager::get().states.back().get();
 
-    static float clockAccumulator = 0.f;
-    static float scriptTimerAccumulator = 0.f;
-    static ScriptInt beepTime = std::numeric_limits<ScriptInt>::max();
     if (currState->shouldWorldUpdate()) {
-        world->chase.update(dt);
-
-        // Clear out any per-tick state.
-        world->clearTickData();
-
-        state.gameTime += dt;
-
-        clockAccumulator += dt;
-        while (clockAccumulator >= 1.f) {
-            state.basic.gameMinute++;
-            while (state.basic.gameMinute >= 60) {
-                state.basic.gameMinute = 0;
-                state.basic.gameHour++;
-                while (state.basic.gameHour >= 24) {
-                    state.basic.gameHour = 0;
-                }
-            }
-            clockAccumulator -= 1.f;
-        }
-
-        constexpr float timerClockRate = 1.f / 30.f;
-
-        if (state.scriptTimerVariable && !state.scriptTimerPaused) {
-            scriptTimerAccumulator += dt;
-            while (scriptTimerAccumulator >= timerClockRate) {
-                // Original game uses milliseconds
-                (*state.scriptTimerVariable) -= timerClockRate * 1000;
-		    
-                //                                11 seconds
-                if (*state.scriptTimerVariable <= 11000 &&
-                    beepTime - *state.scriptTimerVariable >= 1000) {
-                    beepTime = *state.scriptTimerVariable;
-
-                    // @todo beep
-                }
-		    
-                if (*state.scriptTimerVariable <= 0) {
-                    (*state.scriptTimerVariable) = 0;
-                    state.scriptTimerVariable = nullptr;
-                }
-
-                scriptTimerAccumulator -= timerClockRate;
-            }
-        }
-
-        tickObjects(dt);
-
-        state.text.tick(dt);
-
-        if (vm) {
-            try {
-                vm->execute(dt);
-            } catch (SCMException& ex) {
-                std::cerr << ex.what() << std::endl;
-                log.error("Script", ex.what());
-                throw;
-            }
-        }
-
         /// @todo this doesn't make sense as the condition
-        if (state.playerObject) {
-            currentCam.frustum.update(currentCam.frustum.projection() *
-                                      currentCam.getView());
-            // Use the current camera position to spawn pedestrians.
-            world->cleanupTraffic(currentCam);
-            // Only create new traffic outside cutscenes
-            if (!state.currentCutscene) {
-                world->createTraffic(currentCam);
-            }
-        }
-    }
-}
-
-void RWGame::tickObjects(float dt) const {
-    RW_PROFILE_SCOPEC(__func__, MP_MAGENTA1);
-    world->updateEffects();
-
-    {
-        RW_PROFILE_SCOPEC("allObjects", MP_HOTPINK1);
-        RW_PROFILE_COUNTER_SET("tickObjects/allObjects", world->allObjects.size());
-        for (auto &object : world->allObjects) {
-            object->_updateLastTransform();
-            object->tick(dt);
-        }
-    }
-
-    {
-        RW_PROFILE_SCOPEC("garages", MP_HOTPINK2);
-        for (auto &g : world->garages) {
-            g->tick(dt);
-        }
+        // Use the current camera position to spawn pedestrians.
+        world->tick(dt, state.playerObject ? &currentCam : nullptr);
     }
-
-    {
-        RW_PROFILE_SCOPEC("payphones", MP_HOTPINK3);
-        for (auto &p : world->payphones) {
-            p->tick(dt);
-        }
-    }
-
-    world->destroyQueuedObjects();
 }
 
 void RWGame::render(float alpha, float time) {
@@ -769,9 +676,7 @@ void RWGame::renderDebugPaths(float time) {
     }
 
     // Draw the targetNode if a character is driving a vehicle
-    for (auto& p : world->pedestrianPool.objects) {
-        auto v = static_cast<CharacterObject*>(p.second.get());
-
+    for (auto v : world->pedestrianPool) {
         static const btVector3 color(1.f, 1.f, 0.f);
 
         if (v->controller->targetNode && v->getCurrentVehicle()) {
@@ -795,8 +700,8 @@ void RWGame::renderDebugObjects(float time, ViewCamera& camera) {
 
     ss << "Models: " << data.modelinfo.size() << "\n"
        << "Dynamic Objects:\n"
-       << " Vehicles: " << world->vehiclePool.objects.size() << "\n"
-       << " Peds: " << world->pedestrianPool.objects.size() << "\n";
+       << " Vehicles: " << world->vehiclePool.size() << "\n"
+       << " Peds: " << world->pedestrianPool.size() << "\n";
 
     TextRenderer::TextInfo ti;
     ti.font = FONT_ARIAL;
@@ -829,9 +734,8 @@ void RWGame::renderDebugObjects(float time, ViewCamera& camera) {
         renderer.text.renderText(ti);
     };
 
-    for (auto& p : world->vehiclePool.objects) {
-        if (!isnearby(p.second.get())) continue;
-        auto v = static_cast<VehicleObject*>(p.second.get());
+    for (auto v : world->vehiclePool) {
+        if (!isnearby(v)) continue;
 
         std::stringstream ss;
         ss << v->getVehicle()->vehiclename_ << "\n"
@@ -841,9 +745,8 @@ void RWGame::renderDebugObjects(float time, ViewCamera& camera) {
 
         showdata(v, ss);
     }
-    for (auto& p : world->pedestrianPool.objects) {
-        if (!isnearby(p.second.get())) continue;
-        auto c = static_cast<CharacterObject*>(p.second.get());
+    for (auto c : world->pedestrianPool) {
+        if (!isnearby(c)) continue;
         const auto& state = c->getCurrentState();
         auto act = c->controller->getCurrentActivity();
 
@@ -12,6 +12,7 @@
 #pragma warning(default : 4305 5033)
 #endif
 
+#include <core/JobSystem.hpp>
 #include <engine/GameData.hpp>
 #include <engine/GameState.hpp>
 #include <engine/GameWorld.hpp>
@@ -29,6 +30,8 @@ class PlayerController;
 
 class RWGame final : public GameBase {
     GameData data;
+    /// Workers shared by the renderer and the world
+    JobSystem jobs;
     GameRenderer renderer;
     DebugDraw debug;
     GameState state;
@@ -150,8 +153,6 @@ private:
     float tickWorld(const float deltaTime, float accumulatedTime);
 
     void renderDebugView(float time, ViewCamera &viewCam);
-
-    void tickObjects(float dt) const;
 };
 
 #endif
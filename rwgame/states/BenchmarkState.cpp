@@ -2,17 +2,69 @@
 #include <engine/GameState.hpp>
 #include "RWGame.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <functional>
+#include <iomanip>
 #include <iostream>
 
-BenchmarkState::BenchmarkState(RWGame* game, const std::string& benchfile)
-    : State(game), benchfile(benchfile) {
+#include <boost/algorithm/string/predicate.hpp>
+
+namespace {
+/// Enough for the whole track at several hundred frames per second
+constexpr size_t kMaxRecordedFrames = 1 << 17;
+
+struct Spread {
+    double mean = 0.;
+    double stddev = 0.;
+};
+
+template <class T>
+Spread measureSpread(const std::vector<T>& values,
+                     const std::function<double(const T&)>& get) {
+    Spread spread;
+    if (values.empty()) {
+        return spread;
+    }
+    for (const auto& v : values) {
+        spread.mean += get(v);
+    }
+    spread.mean /= values.size();
+    if (values.size() > 1) {
+        double sum = 0.;
+        for (const auto& v : values) {
+            sum += (get(v) - spread.mean) * (get(v) - spread.mean);
+        }
+        spread.stddev = std::sqrt(sum / (values.size() - 1));
+    }
+    return spread;
+}
+
+double toMilliseconds(float seconds) {
+    return seconds * 1000.;
+}
+
+void writeJSONString(std::ostream& out, const std::string& str) {
+    out << '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            out << '\\';
+        }
+        out << c;
+    }
+    out << '"';
+}
+}  // namespace
+
+BenchmarkState::BenchmarkState(RWGame* game, const BenchmarkSettings& settings)
+    : State(game), settings(settings), frameTimes(kMaxRecordedFrames) {
 }
 
 void BenchmarkState::enter() {
     getWindow().hideCursor();
 
-    std::ifstream benchstream(benchfile);
+    std::ifstream benchstream(settings.trackFile);
 
     unsigned int clockHour;
     unsigned int clockMinute;
@@ -59,39 +111,173 @@ void BenchmarkState::enter() {
 
 void BenchmarkState::exit() {
     std::cout << "Results =============\n"
-              << "Benchmark: " << benchfile << "\n"
+              << "Benchmark: " << settings.trackFile << "\n"
               << "Frames: " << frameCounter << "\n"
-              << "Duration: " << duration << " seconds\n"
-              << "Avg frametime: " << std::setprecision(3)
-              << (duration / frameCounter) << " (" << (frameCounter / duration)
-              << " fps)" << std::endl;
-}
+              << "Duration: " << duration << " seconds, " << results.size()
+              << " runs, " << settings.warmupTime << " seconds warm-up\n";
 
-void BenchmarkState::tick(float dt) {
-    if (!track.empty()) {
-        TrackPoint& a = track.front();
-        TrackPoint& b = track.back();
-        for (TrackPoint& p : track) {
-            if (benchmarkTime < p.time) {
-                b = p;
-                break;
-            }
-            a = p;
-        }
-        if (benchmarkTime > duration) {
-            done();
+    std::cout << std::fixed << std::setprecision(2);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& frames = results[i].frames;
+        std::cout << "Run " << i + 1 << ": " << frames.frames << " frames, "
+                  << "avg " << toMilliseconds(frames.mean) << "ms ("
+                  << (frames.mean > 0.f ? 1.f / frames.mean : 0.f)
+                  << " fps), p50 " << toMilliseconds(frames.p50) << "ms, p90 "
+                  << toMilliseconds(frames.p90) << "ms, p99 "
+                  << toMilliseconds(frames.p99) << "ms, max "
+                  << toMilliseconds(frames.max) << "ms, " << frames.hitches
+                  << " hitches\n";
+    }
+
+    if (results.size() > 1) {
+        auto mean = measureSpread<RunResult>(results, [](const RunResult& r) {
+            return toMilliseconds(r.frames.mean);
+        });
+        auto p99 = measureSpread<RunResult>(results, [](const RunResult& r) {
+            return toMilliseconds(r.frames.p99);
+        });
+        std::cout << "Avg frametime: " << mean.mean << "ms +/- " << mean.stddev
+                  << "ms\n"
+                  << "p99 frametime: " << p99.mean << "ms +/- " << p99.stddev
+                  << "ms\n";
+    }
+    std::cout << std::defaultfloat << std::flush;
+
+    if (!settings.outputPath.empty()) {
+        std::ofstream out(settings.outputPath);
+        if (!out) {
+            std::cerr << "Failed to write " << settings.outputPath
+                      << std::endl;
+            return;
         }
-        if (b.time != a.time) {
-            float alpha = (benchmarkTime - a.time) / (b.time - a.time);
-            trackCam.position = glm::mix(a.position, b.position, alpha);
-            trackCam.rotation = glm::slerp(a.angle, b.angle, alpha);
+        if (boost::iends_with(settings.outputPath, ".json")) {
+            writeJSON(out);
+        } else {
+            writeCSV(out);
         }
-        benchmarkTime += dt;
     }
 }
 
+void BenchmarkState::writeJSON(std::ostream& out) const {
+    out << "{\n  \"benchmark\": ";
+    writeJSONString(out, settings.trackFile);
+    out << ",\n  \"warmup\": " << settings.warmupTime
+        << ",\n  \"hitchThresholdMs\": " << toMilliseconds(kHitchFrameTime)
+        << ",\n  \"runs\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        out << (i > 0 ? "," : "") << "\n    {"
+            << "\"frames\": " << r.frames.frames
+            << ", \"meanMs\": " << toMilliseconds(r.frames.mean)
+            << ", \"p50Ms\": " << toMilliseconds(r.frames.p50)
+            << ", \"p90Ms\": " << toMilliseconds(r.frames.p90)
+            << ", \"p99Ms\": " << toMilliseconds(r.frames.p99)
+            << ", \"maxMs\": " << toMilliseconds(r.frames.max)
+            << ", \"hitches\": " << r.frames.hitches
+            << ", \"objectsMs\": " << r.objectsTime
+            << ", \"waterMs\": " << r.waterTime
+            << ", \"skyMs\": " << r.skyTime
+            << ", \"effectsMs\": " << r.effectsTime
+            << ", \"culled\": " << r.culled << "}";
+    }
+    out << "\n  ]";
+
+    auto mean = measureSpread<RunResult>(results, [](const RunResult& r) {
+        return toMilliseconds(r.frames.mean);
+    });
+    auto p99 = measureSpread<RunResult>(results, [](const RunResult& r) {
+        return toMilliseconds(r.frames.p99);
+    });
+    out << ",\n  \"meanMs\": {\"mean\": " << mean.mean
+        << ", \"stddev\": " << mean.stddev << "}"
+        << ",\n  \"p99Ms\": {\"mean\": " << p99.mean
+        << ", \"stddev\": " << p99.stddev << "}\n}\n";
+}
+
+void BenchmarkState::writeCSV(std::ostream& out) const {
+    out << "run,frames,mean_ms,p50_ms,p90_ms,p99_ms,max_ms,hitches,"
+           "objects_ms,water_ms,sky_ms,effects_ms,culled\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        out << i + 1 << "," << r.frames.frames << ","
+            << toMilliseconds(r.frames.mean) << ","
+            << toMilliseconds(r.frames.p50) << ","
+            << toMilliseconds(r.frames.p90) << ","
+            << toMilliseconds(r.frames.p99) << ","
+            << toMilliseconds(r.frames.max) << "," << r.frames.hitches << ","
+            << r.objectsTime << "," << r.waterTime << "," << r.skyTime << ","
+            << r.effectsTime << "," << r.culled << "\n";
+    }
+}
+
+void BenchmarkState::finishRun() {
+    const auto frames = frameTimes.getRecordedCount();
+    current.frames = frameTimes.summarize();
+    if (frames > 0) {
+        current.objectsTime /= frames;
+        current.waterTime /= frames;
+        current.skyTime /= frames;
+        current.effectsTime /= frames;
+        current.culled /= frames;
+    }
+    results.push_back(current);
+
+    current = RunResult();
+    frameTimes.clear();
+
+    if (results.size() >= settings.runs) {
+        done();
+        return;
+    }
+
+    benchmarkTime = 0.f;
+    trackIndex = 0;
+}
+
+void BenchmarkState::tick(float dt) {
+    if (track.empty() || hasExited()) {
+        return;
+    }
+
+    // Points are in time order, so the segment only ever moves forward
+    while (trackIndex + 1 < track.size() &&
+           track[trackIndex + 1].time <= benchmarkTime) {
+        ++trackIndex;
+    }
+    const auto& a = track[trackIndex];
+    const auto& b = track[std::min(trackIndex + 1, track.size() - 1)];
+    if (b.time != a.time) {
+        float alpha = (benchmarkTime - a.time) / (b.time - a.time);
+        trackCam.position = glm::mix(a.position, b.position, alpha);
+        trackCam.rotation = glm::slerp(a.angle, b.angle, alpha);
+    }
+
+    if (benchmarkTime > duration) {
+        finishRun();
+        return;
+    }
+    benchmarkTime += dt;
+}
+
 void BenchmarkState::draw(GameRenderer* r) {
+    const auto now = std::chrono::steady_clock::now();
     frameCounter++;
+
+    // The first frame has no previous frame to measure from
+    if (benchmarkTime >= settings.warmupTime &&
+        lastFrame != std::chrono::steady_clock::time_point{}) {
+        frameTimes.record(std::chrono::duration<float>(now - lastFrame).count());
+
+        // Renderer timings are only collected with RENDER_PROFILER
+        constexpr double kNanoToMilli = 1e-6;
+        current.objectsTime += r->profObjects.duration * kNanoToMilli;
+        current.waterTime += r->profWater.duration * kNanoToMilli;
+        current.skyTime += r->profSky.duration * kNanoToMilli;
+        current.effectsTime += r->profEffects.duration * kNanoToMilli;
+        current.culled += r->getCulledCount();
+    }
+    lastFrame = now;
+
     State::draw(r);
 }
 
@@ -1,8 +1,22 @@
 #ifndef _RWGAME_BENCHMARKSTATE_HPP_
 #define _RWGAME_BENCHMARKSTATE_HPP_
 
+#include <chrono>
+
+#include "FrameStats.hpp"
 #include "State.hpp"
 
+struct BenchmarkSettings {
+    /// Camera track to follow
+    std::string trackFile;
+    /// Number of times to play the track
+    unsigned int runs = 1;
+    /// Seconds at the start of each run that aren't measured
+    float warmupTime = 2.f;
+    /// Writes the results as JSON, or CSV unless the path ends in .json
+    std::string outputPath;
+};
+
 class BenchmarkState final : public State {
     struct TrackPoint {
         float time;
@@ -10,17 +24,42 @@ class BenchmarkState final : public State {
         glm::quat angle{1.0f,0.0f,0.0f,0.0f};
     };
     std::vector<TrackPoint> track;
+    /// Index of the point the current segment starts at
+    size_t trackIndex{0};
+
+    /**
+     * Measurements of one playthrough of the track, renderer timings are
+     * averages per frame in milliseconds
+     */
+    struct RunResult {
+        FrameTimeSummary frames;
+        double objectsTime{0.};
+        double waterTime{0.};
+        double skyTime{0.};
+        double effectsTime{0.};
+        double culled{0.};
+    };
+    std::vector<RunResult> results;
+    RunResult current;
 
     ViewCamera trackCam;
 
-    std::string benchfile;
+    BenchmarkSettings settings;
+
+    FrameTimeRecorder frameTimes;
+    std::chrono::steady_clock::time_point lastFrame{};
 
     float benchmarkTime{0.f};
     float duration{0.f};
     uint32_t frameCounter{0};
 
+    void finishRun();
+
+    void writeJSON(std::ostream& out) const;
+    void writeCSV(std::ostream& out) const;
+
 public:
-    BenchmarkState(RWGame* game, const std::string& benchfile);
+    BenchmarkState(RWGame* game, const BenchmarkSettings& settings);
 
     void enter() override;
 
@@ -128,8 +128,7 @@ std::shared_ptr<Menu> DebugState::createMapMenu() {
                   "vheistlocdoor"}};
 
               auto gw = game->getWorld();
-              for (auto& [id, instancePtr] : gw->instancePool.objects) {
-                  auto obj = static_cast<InstanceObject*>(instancePtr.get());
+              for (auto obj : gw->instancePool) {
                   if (std::find(garageDoorModels.begin(),
                                 garageDoorModels.end(),
                                 obj->getModelInfo<BaseModelInfo>()->name) !=
@@ -197,8 +196,7 @@ std::shared_ptr<Menu> DebugState::createAIMenu() {
     }
 
     menu->lambda("Kill All Peds", [=] {
-        for (auto& [id, pedestrianPtr] :
-             game->getWorld()->pedestrianPool.objects) {
+        for (auto pedestrianPtr : game->getWorld()->pedestrianPool) {
             if (pedestrianPtr->getLifetime() == GameObject::PlayerLifetime) {
                 continue;
             }
@@ -508,7 +508,7 @@ const ViewCamera& IngameState::getCamera(float alpha) {
 }
 
 GameObject* IngameState::getCameraTarget() const {
-    auto target =
+    GameObject* target =
         getWorld()->pedestrianPool.find(game->getState()->cameraTarget);
 
     if (target == nullptr && game->getWorld()->getPlayer()) {
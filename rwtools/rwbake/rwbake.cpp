@@ -0,0 +1,135 @@
+#include <data/CollisionModel.hpp>
+#include <loaders/AssetCache.hpp>
+#include <loaders/LoaderCOL.hpp>
+#include <loaders/LoaderIFP.hpp>
+#include <platform/FileHandle.hpp>
+#include <platform/MappedFile.hpp>
+#include <rw/filesystem.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+enum class BakeResult { Baked, UpToDate, Failed };
+
+BakeResult bakeCollisions(const AssetCache &cache, const std::string &name,
+                          std::shared_ptr<MappedFile> file) {
+    const auto hash = AssetCache::hashContents(file->data(), file->size());
+
+    std::vector<std::unique_ptr<CollisionModel>> baked;
+    if (cache.loadCollisions(name, hash, baked)) {
+        return BakeResult::UpToDate;
+    }
+
+    LoaderCOL loader;
+    const auto length = file->size();
+    if (!loader.loadFromMemory(FileContentsInfo(std::move(file), 0, length),
+                               name)) {
+        return BakeResult::Failed;
+    }
+    return cache.bakeCollisions(name, hash, loader.collisions)
+               ? BakeResult::Baked
+               : BakeResult::Failed;
+}
+
+BakeResult bakeAnimations(const AssetCache &cache, const std::string &name,
+                          std::shared_ptr<MappedFile> file) {
+    const auto hash = AssetCache::hashContents(file->data(), file->size());
+
+    AnimationSet baked;
+    if (cache.loadAnimations(name, hash, baked)) {
+        return BakeResult::UpToDate;
+    }
+
+    LoaderIFP loader;
+    if (!loader.loadFromMemory(file->data())) {
+        return BakeResult::Failed;
+    }
+    return cache.bakeAnimations(name, hash, loader.animations)
+               ? BakeResult::Baked
+               : BakeResult::Failed;
+}
+
+int main(int argc, const char *argv[]) {
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help", "Show this help message")
+        ("data,d", po::value<rwfs::path>()->value_name("PATH")->required(), "Path to the game data")
+        ("output,o", po::value<rwfs::path>()->value_name("PATH")->required(), "Asset cache directory")
+        ;
+
+    po::variables_map vm;
+    try {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help")) {
+            std::cout << desc;
+            return EXIT_SUCCESS;
+        }
+        po::notify(vm);
+    } catch (po::error &ex) {
+        std::cerr << "Error parsing arguments: " << ex.what() << std::endl;
+        std::cerr << desc;
+        return EXIT_FAILURE;
+    }
+
+    const auto dataPath = vm["data"].as<rwfs::path>();
+    AssetCache cache(vm["output"].as<rwfs::path>());
+
+    if (!rwfs::is_directory(dataPath)) {
+        std::cerr << "Not a directory: " << dataPath.string() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    unsigned baked = 0, upToDate = 0, failed = 0;
+    for (const auto &entry : rwfs::recursive_directory_iterator(dataPath)) {
+        const auto &path = entry.path();
+        auto extension = path.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+                       ::tolower);
+        if (extension != ".col" && extension != ".ifp") {
+            continue;
+        }
+
+        auto file = MappedFile::open(path);
+        if (!file) {
+            continue;
+        }
+
+        const auto name = path.filename().string();
+        auto result = BakeResult::Failed;
+        try {
+            result = extension == ".col"
+                         ? bakeCollisions(cache, name, std::move(file))
+                         : bakeAnimations(cache, name, std::move(file));
+        } catch (std::exception &ex) {
+            std::cerr << name << ": " << ex.what() << "\n";
+        }
+
+        switch (result) {
+            case BakeResult::Baked:
+                std::cout << "Baked " << name << "\n";
+                ++baked;
+                break;
+            case BakeResult::UpToDate:
+                ++upToDate;
+                break;
+            case BakeResult::Failed:
+                std::cerr << "Failed to bake " << name << "\n";
+                ++failed;
+                break;
+        }
+    }
+
+    std::cout << baked << " baked, " << upToDate << " up to date, " << failed
+              << " failed\n";
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
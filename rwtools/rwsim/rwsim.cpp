@@ -0,0 +1,206 @@
+#include <ai/PlayerController.hpp>
+#include <core/JobSystem.hpp>
+#include <core/Logger.hpp>
+#include <engine/GameData.hpp>
+#include <engine/GameState.hpp>
+#include <engine/GameWorld.hpp>
+#include <gl/Headless.hpp>
+#include <objects/CharacterObject.hpp>
+#include <render/ViewCamera.hpp>
+#include <rw/filesystem.hpp>
+#include <script/SCMFile.hpp>
+#include <script/ScriptMachine.hpp>
+#include <script/modules/GTA3Module.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace po = boost::program_options;
+
+namespace {
+constexpr float kTimeStep = 1.f / 60.f;
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Wall time spent in each part of a tick, in seconds
+ */
+struct TickTimings {
+    double physics = 0.;
+    WorldTickTimings world;
+    double total = 0.;
+};
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/**
+ * Owns everything needed to step the world, without a window or renderer
+ */
+class Simulation {
+public:
+    Simulation(Logger& log, const rwfs::path& dataPath,
+               const std::string& language)
+        : log(log), data(&log, dataPath) {
+        data.load();
+        data.loadDynamicObjects((dataPath / "data/object.dat").string());
+        data.loadGXT("text/" + language + ".gxt");
+
+        world = std::make_unique<GameWorld>(&log, &data, &jobs);
+        state.world = world.get();
+        world->state = &state;
+
+        for (const auto& ipl : data.iplLocations) {
+            data.loadZone(ipl.second);
+            world->placeItems(ipl.second);
+        }
+    }
+
+    bool startScript(const std::string& name) {
+        script = data.loadSCM(name);
+        if (!script) {
+            log.error("Sim", "Failed to load SCM: " + name);
+            return false;
+        }
+        vm = std::make_unique<ScriptMachine>(&state, script, &opcodes);
+        state.script = vm.get();
+        return true;
+    }
+
+    /**
+     * Same work as a game tick, minus input, states and rendering
+     */
+    void tick(float dt, TickTimings& timings) {
+        const auto tickStart = Clock::now();
+        const float scaledDt = dt * state.basic.timeScale;
+
+        world->stepPhysics(scaledDt, dt);
+        timings.physics += secondsSince(tickStart);
+
+        // Traffic spawns around the camera, follow the player with it
+        ViewCamera* trafficCamera = nullptr;
+        if (auto player = world->getPlayer()) {
+            camera.position = player->getCharacter()->getPosition();
+            trafficCamera = &camera;
+        }
+        world->tick(scaledDt, trafficCamera, &timings.world);
+
+        state.swapInputState();
+        timings.total += secondsSince(tickStart);
+    }
+
+    GameWorld& getWorld() {
+        return *world;
+    }
+
+private:
+    Logger& log;
+    GameData data;
+    GameState state;
+    JobSystem jobs;
+    std::unique_ptr<GameWorld> world;
+
+    GTA3Module opcodes;
+    std::unique_ptr<ScriptMachine> vm;
+    SCMFile script;
+
+    ViewCamera camera;
+};
+
+void printTiming(const char* name, double seconds, unsigned long ticks,
+                 double total) {
+    std::cout << std::left << std::setw(10) << name << std::right
+              << std::setw(10) << std::fixed << std::setprecision(3)
+              << seconds * 1000. / ticks << " ms/tick" << std::setw(8)
+              << std::setprecision(1) << seconds * 100. / total << "%\n";
+}
+}  // namespace
+
+int main(int argc, const char* argv[]) {
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help", "Show this help message")
+        ("data,d", po::value<rwfs::path>()->value_name("PATH")->required(), "Path to the game data")
+        ("ticks,t", po::value<unsigned long>()->value_name("N")->default_value(36000), "Number of ticks to simulate")
+        ("language", po::value<std::string>()->value_name("NAME")->default_value("american"), "Game text language")
+        ("no-script", "Don't run main.scm")
+        ;
+
+    po::variables_map vm;
+    try {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help")) {
+            std::cout << desc;
+            return EXIT_SUCCESS;
+        }
+        po::notify(vm);
+    } catch (po::error& ex) {
+        std::cerr << "Error parsing arguments: " << ex.what() << std::endl;
+        std::cerr << desc;
+        return EXIT_FAILURE;
+    }
+
+    const auto dataPath = vm["data"].as<rwfs::path>();
+    const auto ticks = vm["ticks"].as<unsigned long>();
+    if (!GameData::isValidGameDirectory(dataPath)) {
+        std::cerr << "Invalid game directory: " << dataPath.string() << "\n";
+        return EXIT_FAILURE;
+    }
+    if (ticks == 0) {
+        std::cerr << "Nothing to simulate\n";
+        return EXIT_FAILURE;
+    }
+
+    // Nothing below may touch GL, there is no context
+    setGLHeadless(true);
+
+    StdOutReceiver logstdout;
+    Logger log({&logstdout});
+
+    auto loadStart = Clock::now();
+    Simulation sim(log, dataPath, vm["language"].as<std::string>());
+    if (!vm.count("no-script") && !sim.startScript("data/main.scm")) {
+        return EXIT_FAILURE;
+    }
+    const auto loadTime = secondsSince(loadStart);
+
+    TickTimings timings;
+    try {
+        for (unsigned long i = 0; i < ticks; ++i) {
+            sim.tick(kTimeStep, timings);
+        }
+    } catch (SCMException& ex) {
+        std::cerr << "Script error: " << ex.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    const auto simulated = ticks * static_cast<double>(kTimeStep);
+    std::cout << "Loaded in " << std::fixed << std::setprecision(2)
+              << loadTime << "s\n"
+              << "Simulated " << ticks << " ticks (" << simulated
+              << "s of game time) in " << timings.total << "s\n"
+              << std::setprecision(1) << ticks / timings.total
+              << " ticks/s, " << simulated / timings.total
+              << "x real time\n"
+              << "Objects: " << sim.getWorld().allObjects.size() << "\n\n";
+
+    const auto& world = timings.world;
+    const auto other = timings.total - timings.physics - world.objects -
+                       world.script - world.traffic - world.streaming;
+    printTiming("physics", timings.physics, ticks, timings.total);
+    printTiming("objects", world.objects, ticks, timings.total);
+    printTiming("script", world.script, ticks, timings.total);
+    printTiming("traffic", world.traffic, ticks, timings.total);
+    printTiming("streaming", world.streaming, ticks, timings.total);
+    printTiming("other", other, ticks, timings.total);
+    printTiming("total", timings.total, ticks, timings.total);
+
+    return EXIT_SUCCESS;
+}
@@ -11,6 +11,7 @@
 #include <objects/VehicleObject.hpp>
 #include <render/GameRenderer.hpp>
 #include <render/ObjectRenderer.hpp>
+#include <render/RenderSort.hpp>
 #include <render/TextRenderer.hpp>
 
 #include <QFileDialog>
@@ -106,11 +107,7 @@ void ViewerWidget::drawObject(GameRenderer &r, GameObject *object) {
     ObjectRenderer objectRenderer(world(), vc, 1.f);
     RenderList renders;
     objectRenderer.buildRenderList(object, renders);
-    std::sort(renders.begin(), renders.end(),
-              [](const Renderer::RenderInstruction& a,
-                 const Renderer::RenderInstruction& b) {
-                  return a.sortKey < b.sortKey;
-              });
+    RenderListSorter().sort(renders);
     r.getRenderer()->drawBatched(renders);
     r.renderPostProcess();
 }
@@ -266,12 +263,12 @@ void ViewerWidget::exportModel() {
 	auto it = world()->objectTypes.find(currentObjectID);
 	if( it != world()->objectTypes.end() ) {
 		for( auto& archive : world()->data.archives ) {
-			for(size_t i = 0; i < archive.second.getAssetCount(); ++i) {
-				auto& assetI = archive.second.getAssetInfoByIndex(i);;
+			for(size_t i = 0; i < archive.second->getAssetCount(); ++i) {
+				auto& assetI = archive.second->getAssetInfoByIndex(i);;
 				std::string q(assetI.name);
 				std::transform(q.begin(), q.end(), q.begin(), ::tolower);
 				if( q.find(it->second->modelName) != q.npos ) {
-					archive.second.saveAsset(q, toSv.toStdString());
+					archive.second->saveAsset(q, toSv.toStdString());
 				}
 			}
 		}
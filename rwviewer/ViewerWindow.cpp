@@ -146,8 +146,10 @@ void ViewerWindow::loadGame(const QString& path) {
     gameData = std::make_unique<GameData>(&engineLog, gameDir.absolutePath().toStdString());
     gameData->load();
 
-    gameWorld = std::make_unique<GameWorld>(&engineLog, gameData.get());
-    renderer = std::make_unique<GameRenderer>(&engineLog, gameData.get());
+    gameWorld =
+        std::make_unique<GameWorld>(&engineLog, gameData.get(), &jobs);
+    renderer =
+        std::make_unique<GameRenderer>(&engineLog, gameData.get(), &jobs);
     gameWorld->state = new GameState;
 
     renderer->text.setFontTexture(FONT_PAGER, "pager");
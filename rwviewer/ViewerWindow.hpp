@@ -3,6 +3,7 @@
 
 #include "QOpenGLContextWrapper.hpp"
 
+#include <core/JobSystem.hpp>
 #include <core/Logger.hpp>
 #include <engine/GameData.hpp>
 #include <engine/GameWorld.hpp>
@@ -25,6 +26,7 @@ class ViewerWindow : public QMainWindow {
     QTabWidget* views;
 
     Logger engineLog;
+    JobSystem jobs;
 
     std::unique_ptr<GameData> gameData;
     std::unique_ptr<GameWorld> gameWorld;
@@ -0,0 +1,177 @@
+#include <boost/test/unit_test.hpp>
+#include <ai/AIGraph.hpp>
+#include <ai/AIGraphNode.hpp>
+#include <ai/AIRouteSearch.hpp>
+#include <data/PathData.hpp>
+
+#include <limits>
+
+namespace {
+void addPath(AIGraph& graph, PathData::PathType type,
+             const glm::vec3& position) {
+    PathData path{type, 0, "", {}};
+    path.nodes.push_back({PathNode::INTERNAL, 1, {}, 1.f, 1, 1});
+    path.nodes.push_back({PathNode::INTERNAL, -1, {10.f, 0.f, 0.f}, 1.f, 1, 1});
+    graph.createPathNodes(position, glm::quat{1.f, 0.f, 0.f, 0.f}, path);
+}
+
+void addPath(AIGraph& graph, const std::vector<glm::vec3>& points) {
+    PathData path{PathData::PATH_CAR, 0, "", {}};
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto last = i + 1 == points.size();
+        path.nodes.push_back(
+            {(i == 0 || last) ? PathNode::EXTERNAL : PathNode::INTERNAL,
+             last ? -1 : static_cast<int32_t>(i + 1), points[i], 1.f, 1, 1});
+    }
+    graph.createPathNodes({}, glm::quat{1.f, 0.f, 0.f, 0.f}, path);
+}
+
+/// Two routes between nodes 0 and 2, through 1 or through 3 and 4
+void createLoop(AIGraph& graph) {
+    addPath(graph, {{0.f, 0.f, 0.f}, {10.f, 0.f, 0.f}, {20.f, 0.f, 0.f}});
+    addPath(graph, {{0.f, 0.f, 0.f},
+                    {0.f, 30.f, 0.f},
+                    {20.f, 30.f, 0.f},
+                    {20.f, 0.f, 0.f}});
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(AIGraphTests)
+
+BOOST_AUTO_TEST_CASE(test_find_nearest) {
+    AIGraph graph;
+    addPath(graph, PathData::PATH_PED, {100.f, 100.f, 0.f});
+    addPath(graph, PathData::PATH_PED, {-1500.f, 900.f, 0.f});
+    addPath(graph, PathData::PATH_CAR, {0.f, 0.f, 0.f});
+    // Outside of the world grid
+    addPath(graph, PathData::PATH_PED, {2500.f, 0.f, 0.f});
+    BOOST_REQUIRE_EQUAL(graph.nodes.size(), 8);
+
+    auto node = graph.findNearest(AIGraphNode::Pedestrian, {0.f, 0.f, 0.f});
+    BOOST_REQUIRE(node != nullptr);
+    BOOST_CHECK_EQUAL(node, graph.nodes[0].get());
+
+    node = graph.findNearest(AIGraphNode::Vehicle, {100.f, 100.f, 0.f});
+    BOOST_REQUIRE(node != nullptr);
+    BOOST_CHECK_EQUAL(node, graph.nodes[5].get());
+
+    node = graph.findNearest(AIGraphNode::Pedestrian, {-1400.f, 1000.f, 0.f});
+    BOOST_CHECK_EQUAL(node, graph.nodes[3].get());
+
+    node = graph.findNearest(AIGraphNode::Pedestrian, {3000.f, 0.f, 0.f});
+    BOOST_CHECK_EQUAL(node, graph.nodes[7].get());
+
+    node = graph.findNearest(AIGraphNode::Pedestrian, {1800.f, 0.f, 0.f});
+    BOOST_CHECK_EQUAL(node, graph.nodes[6].get());
+
+    // Too far away
+    node = graph.findNearest(AIGraphNode::Pedestrian, {0.f, 0.f, 0.f}, 100.f);
+    BOOST_CHECK(node == nullptr);
+
+    // Filtered out
+    node = graph.findNearest(
+        AIGraphNode::Pedestrian, {0.f, 0.f, 0.f},
+        std::numeric_limits<float>::max(),
+        [&](const AIGraphNode* n) { return n->position.x < 0.f; });
+    BOOST_CHECK_EQUAL(node, graph.nodes[3].get());
+}
+
+BOOST_AUTO_TEST_CASE(test_find_route) {
+    AIGraph graph;
+    createLoop(graph);
+    BOOST_REQUIRE_EQUAL(graph.nodes.size(), 5);
+    const auto node = [&](size_t i) { return graph.nodes[i].get(); };
+
+    AIRoute route;
+    BOOST_REQUIRE(graph.findRoute(node(0), node(2), route));
+    BOOST_CHECK(route == AIRoute({node(0), node(1), node(2)}));
+
+    BOOST_REQUIRE(graph.findRoute(node(3), node(1), route));
+    BOOST_CHECK(route == AIRoute({node(3), node(0), node(1)}));
+
+    // The route is cached until the nodes change
+    node(1)->disabled = true;
+    BOOST_REQUIRE(graph.findCachedRoute(node(0), node(2), route));
+    BOOST_CHECK_EQUAL(route.size(), 3);
+
+    graph.clearRouteCache();
+    BOOST_CHECK(!graph.findCachedRoute(node(0), node(2), route));
+    BOOST_REQUIRE(graph.findRoute(node(0), node(2), route));
+    BOOST_CHECK(route == AIRoute({node(0), node(3), node(4), node(2)}));
+
+    // The goal can't be reached
+    BOOST_CHECK(!graph.findRoute(node(0), node(1), route));
+    BOOST_CHECK(route.empty());
+    BOOST_CHECK(graph.findCachedRoute(node(0), node(1), route));
+    BOOST_CHECK(route.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_route_search_steps) {
+    AIGraph graph;
+    createLoop(graph);
+    const auto node = [&](size_t i) { return graph.nodes[i].get(); };
+
+    AIRouteSearch search(graph, node(1), node(4));
+    size_t steps = 0;
+    while (search.step(1) == AIRouteSearch::Searching) {
+        ++steps;
+    }
+    BOOST_CHECK_GT(steps, 1);
+    BOOST_REQUIRE_EQUAL(search.getStatus(), AIRouteSearch::Found);
+    BOOST_CHECK(search.getRoute() ==
+                AIRoute({node(1), node(2), node(4)}));
+
+    AIRouteSearch noGoal(graph, node(0), nullptr);
+    BOOST_CHECK_EQUAL(noGoal.run(), AIRouteSearch::NotFound);
+}
+
+BOOST_AUTO_TEST_CASE(test_stale_route_search) {
+    AIGraph graph;
+    createLoop(graph);
+    const auto node = [&](size_t i) { return graph.nodes[i].get(); };
+
+    // The cache is cleared while the search is running
+    AIRouteSearch search(graph, node(1), node(4));
+    search.step(1);
+    graph.clearRouteCache();
+    BOOST_REQUIRE_EQUAL(search.run(), AIRouteSearch::Found);
+    BOOST_CHECK(!graph.cacheRoute(search));
+
+    AIRoute route;
+    BOOST_CHECK(!graph.findCachedRoute(node(1), node(4), route));
+
+    AIRouteSearch restarted(graph, node(1), node(4));
+    restarted.run();
+    BOOST_CHECK(graph.cacheRoute(restarted));
+    BOOST_CHECK(graph.findCachedRoute(node(1), node(4), route));
+}
+
+BOOST_AUTO_TEST_CASE(test_route_search_reuses_buffers) {
+    AIGraph graph;
+    createLoop(graph);
+    const auto node = [&](size_t i) { return graph.nodes[i].get(); };
+
+    // Searches running at the same time don't share buffers
+    AIRouteSearch first(graph, node(1), node(4));
+    first.step(1);
+    AIRouteSearch second(graph, node(4), node(1));
+    BOOST_REQUIRE_EQUAL(second.run(), AIRouteSearch::Found);
+    BOOST_CHECK(second.getRoute() == AIRoute({node(4), node(2), node(1)}));
+    BOOST_REQUIRE_EQUAL(first.run(), AIRouteSearch::Found);
+    BOOST_CHECK(first.getRoute() == AIRoute({node(1), node(2), node(4)}));
+
+    // Later searches don't see the nodes visited by earlier ones
+    AIRouteSearch again(graph, node(1), node(4));
+    BOOST_REQUIRE_EQUAL(again.run(), AIRouteSearch::Found);
+    BOOST_CHECK(again.getRoute() == first.getRoute());
+
+    // The buffers grow with the graph
+    const auto count = graph.nodes.size();
+    addPath(graph, {{500.f, 0.f, 0.f}, {510.f, 0.f, 0.f}});
+    BOOST_REQUIRE_EQUAL(graph.nodes.size(), count + 2);
+    AIRouteSearch added(graph, node(count), node(count + 1));
+    BOOST_REQUIRE_EQUAL(added.run(), AIRouteSearch::Found);
+    BOOST_CHECK(added.getRoute() == AIRoute({node(count), node(count + 1)}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -46,4 +46,37 @@ BOOST_AUTO_TEST_CASE(test_matrix) {
 }
 #endif
 
+BOOST_AUTO_TEST_CASE(test_keyframe_cursor) {
+    AnimationBone bone("bone", 0, 0, 3.f, AnimationBone::RT0,
+                       std::vector<AnimationKeyframe>{
+                           {glm::quat{1.f, 0.f, 0.f, 0.f},
+                            glm::vec3(0.f, 0.f, 0.f), glm::vec3(1.f), 0.f, 0},
+                           {glm::quat{1.f, 0.f, 0.f, 0.f},
+                            glm::vec3(1.f, 0.f, 0.f), glm::vec3(1.f), 1.f, 1},
+                           {glm::quat{1.f, 0.f, 0.f, 0.f},
+                            glm::vec3(3.f, 0.f, 0.f), glm::vec3(1.f), 3.f, 2},
+                       });
+
+    // Sampling with a cursor gives the same results as searching from the
+    // start, including when time wraps around
+    size_t cursor = 0;
+    for (float time : {0.f, 0.5f, 1.f, 2.f, 2.5f, 0.25f, 1.5f, 4.f, 0.f}) {
+        const auto expected = bone.getInterpolatedKeyframe(time);
+        const auto sampled = bone.getInterpolatedKeyframe(time, cursor);
+        BOOST_CHECK(sampled.position == expected.position);
+        BOOST_CHECK_EQUAL(sampled.id, expected.id);
+    }
+
+    size_t first = 0, second = 0;
+    float alpha = 0.f;
+    cursor = 0;
+    BOOST_REQUIRE(bone.findKeyframes(2.f, cursor, first, second, alpha));
+    BOOST_CHECK_EQUAL(first, 1);
+    BOOST_CHECK_EQUAL(second, 2);
+    BOOST_CHECK_EQUAL(alpha, 0.5f);
+    BOOST_CHECK(!bone.findKeyframes(3.5f, cursor, first, second, alpha));
+    BOOST_CHECK(bone.getInterpolatedKeyframe(3.5f).position ==
+                glm::vec3(3.f, 0.f, 0.f));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -28,6 +28,16 @@ BOOST_AUTO_TEST_CASE(test_open_archive) {
     BOOST_CHECK_EQUAL(f2.offset, f.offset);
     BOOST_CHECK_EQUAL(f2.size, f.size);
 }
+
+BOOST_AUTO_TEST_CASE(test_find_asset_case_insensitive) {
+    LoaderIMG archive;
+
+    BOOST_REQUIRE(archive.load(Global::getGamePath() + "/models/gta3"));
+
+    BOOST_CHECK_EQUAL(archive.findAssetIndex("RADAR00.TXD"), 0);
+    BOOST_CHECK_EQUAL(archive.findAssetIndex("Radar00.txd"), 0);
+    BOOST_CHECK_EQUAL(archive.findAssetIndex("not_an_asset.dff"), -1);
+}
 #endif
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,137 @@
+#include <boost/test/unit_test.hpp>
+#include <data/CollisionModel.hpp>
+#include <loaders/AssetCache.hpp>
+#include <loaders/LoaderIFP.hpp>
+#include "test_Globals.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+struct WithCacheDirectory {
+    rwfs::path directory = rwfs::temp_directory_path() /
+                           rwfs::unique_path("openrw_test_%%%%%%%%%%%%%%%%");
+    AssetCache cache{directory};
+
+    ~WithCacheDirectory() {
+        rwfs::error_code ec;
+        rwfs::remove_all(directory, ec);
+    }
+};
+
+std::vector<std::unique_ptr<CollisionModel>> createCollisions() {
+    auto model = std::make_unique<CollisionModel>();
+    model->name = "testmodel";
+    model->modelid = 42;
+    model->boundingSphere.center = {1.f, 2.f, 3.f};
+    model->boundingSphere.radius = 4.f;
+    model->boundingBox.min = {-1.f, -2.f, -3.f};
+    model->boundingBox.max = {1.f, 2.f, 3.f};
+    model->spheres.push_back({{0.f, 0.f, 1.f}, 0.5f, {1, 2, 3, 4}});
+    model->boxes.push_back({{0.f, 0.f, 0.f}, {1.f, 1.f, 1.f}, {5, 6, 7, 8}});
+    model->vertices = {{0.f, 0.f, 0.f}, {1.f, 0.f, 0.f}, {0.f, 1.f, 0.f}};
+    model->faces.push_back({{0, 1, 2}, {9, 10, 11, 12}});
+
+    std::vector<std::unique_ptr<CollisionModel>> collisions;
+    collisions.emplace_back(std::move(model));
+    return collisions;
+}
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(AssetCacheTests, WithCacheDirectory)
+
+BOOST_AUTO_TEST_CASE(test_disabled_cache) {
+    AssetCache disabled;
+    BOOST_CHECK(!disabled.isEnabled());
+    BOOST_CHECK(!disabled.bakeCollisions("test.col", 1, createCollisions()));
+
+    std::vector<std::unique_ptr<CollisionModel>> loaded;
+    BOOST_CHECK(!disabled.loadCollisions("test.col", 1, loaded));
+}
+
+BOOST_AUTO_TEST_CASE(test_baked_path_ignores_directories_and_case) {
+    BOOST_CHECK(cache.getBakedPath("models/coll/Generic.COL") ==
+                cache.getBakedPath("MODELS\\COLL\\GENERIC.col"));
+}
+
+BOOST_AUTO_TEST_CASE(test_collisions_round_trip) {
+    const auto collisions = createCollisions();
+    BOOST_REQUIRE(cache.bakeCollisions("models/coll/test.col", 1234, collisions));
+
+    std::vector<std::unique_ptr<CollisionModel>> loaded;
+    BOOST_REQUIRE(cache.loadCollisions("models/coll/test.col", 1234, loaded));
+    BOOST_REQUIRE_EQUAL(loaded.size(), 1);
+
+    const auto& model = *loaded[0];
+    const auto& expected = *collisions[0];
+    BOOST_CHECK_EQUAL(model.name, expected.name);
+    BOOST_CHECK_EQUAL(model.modelid, expected.modelid);
+    BOOST_CHECK(model.boundingSphere.center == expected.boundingSphere.center);
+    BOOST_CHECK_EQUAL(model.boundingSphere.radius,
+                      expected.boundingSphere.radius);
+    BOOST_CHECK(model.boundingBox.max == expected.boundingBox.max);
+    BOOST_REQUIRE_EQUAL(model.spheres.size(), 1);
+    BOOST_CHECK_EQUAL(model.spheres[0].surface.light, 4);
+    BOOST_REQUIRE_EQUAL(model.boxes.size(), 1);
+    BOOST_CHECK(model.boxes[0].max == expected.boxes[0].max);
+    BOOST_CHECK(model.vertices == expected.vertices);
+    BOOST_REQUIRE_EQUAL(model.faces.size(), 1);
+    BOOST_CHECK_EQUAL(model.faces[0].tri[2], 2);
+    BOOST_CHECK_EQUAL(model.faces[0].surface.material, 9);
+}
+
+BOOST_AUTO_TEST_CASE(test_stale_entry_is_ignored) {
+    BOOST_REQUIRE(cache.bakeCollisions("test.col", 1234, createCollisions()));
+
+    std::vector<std::unique_ptr<CollisionModel>> loaded;
+    BOOST_CHECK(!cache.loadCollisions("test.col", 4321, loaded));
+    BOOST_CHECK(loaded.empty());
+
+    AnimationSet animations;
+    BOOST_CHECK(!cache.loadAnimations("test.col", 1234, animations));
+}
+
+BOOST_AUTO_TEST_CASE(test_animations_round_trip) {
+    auto animation = std::make_shared<Animation>();
+    animation->name = "Walk";
+    animation->duration = 2.f;
+    animation->bones.emplace(
+        "root", std::make_unique<AnimationBone>(
+                    "Root", 0, 0, 2.f, AnimationBone::RT0,
+                    std::vector<AnimationKeyframe>{
+                        {glm::quat{1.f, 0.f, 0.f, 0.f}, glm::vec3{0.f},
+                         glm::vec3{1.f}, 0.f, 0},
+                        {glm::quat{1.f, 0.f, 0.f, 0.f}, glm::vec3{1.f},
+                         glm::vec3{1.f}, 2.f, 1}}));
+    AnimationSet animations{{"walk", animation}};
+
+    BOOST_REQUIRE(cache.bakeAnimations("ped.ifp", 99, animations));
+
+    AnimationSet loaded;
+    BOOST_REQUIRE(cache.loadAnimations("ped.ifp", 99, loaded));
+    BOOST_REQUIRE_EQUAL(loaded.count("walk"), 1);
+
+    const auto& walk = *loaded["walk"];
+    BOOST_CHECK_EQUAL(walk.name, "Walk");
+    BOOST_CHECK_EQUAL(walk.duration, 2.f);
+    BOOST_REQUIRE_EQUAL(walk.bones.count("root"), 1);
+
+    const auto& bone = *walk.bones.at("root");
+    BOOST_CHECK_EQUAL(bone.name, "Root");
+    BOOST_CHECK(bone.type == AnimationBone::RT0);
+    BOOST_REQUIRE_EQUAL(bone.getKeyframeCount(), 2);
+    BOOST_CHECK(bone.getFrame(1).position == glm::vec3{1.f});
+    BOOST_CHECK_EQUAL(bone.getFrame(1).starttime, 2.f);
+}
+
+BOOST_AUTO_TEST_CASE(test_hash_contents) {
+    const char a[] = "collision";
+    const char b[] = "collisioN";
+    BOOST_CHECK_EQUAL(AssetCache::hashContents(a, sizeof(a)),
+                      AssetCache::hashContents(a, sizeof(a)));
+    BOOST_CHECK_NE(AssetCache::hashContents(a, sizeof(a)),
+                   AssetCache::hashContents(b, sizeof(b)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
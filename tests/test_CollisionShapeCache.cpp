@@ -0,0 +1,39 @@
+#include <boost/test/unit_test.hpp>
+#include <data/CollisionModel.hpp>
+#include <dynamics/CollisionShapeCache.hpp>
+
+BOOST_AUTO_TEST_SUITE(CollisionShapeCacheTests)
+
+BOOST_AUTO_TEST_CASE(test_shared_shapes) {
+    CollisionModel box;
+    box.boxes.push_back({{-1.f, -1.f, 0.f}, {1.f, 1.f, 2.f}, {}});
+    box.spheres.push_back({{0.f, 0.f, 3.f}, 1.f, {}});
+
+    CollisionModel mesh;
+    mesh.vertices = {{0.f, 0.f, 0.f}, {1.f, 0.f, 0.f}, {0.f, 1.f, 0.f}};
+    mesh.faces.push_back({{0, 1, 2}, {}});
+
+    CollisionShapeCache cache;
+    auto boxShape = cache.getShape(&box);
+    BOOST_REQUIRE(boxShape != nullptr);
+    BOOST_CHECK_EQUAL(boxShape->children.size(), 2);
+    BOOST_CHECK_CLOSE(boxShape->height, 4.f, 0.001f);
+
+    // Every body of a model uses the same shape
+    BOOST_CHECK(cache.getShape(&box) == boxShape);
+    BOOST_CHECK_EQUAL(cache.size(), 1);
+
+    auto meshShape = cache.getShape(&mesh);
+    BOOST_CHECK(meshShape != boxShape);
+    BOOST_CHECK_EQUAL(meshShape->children.size(), 1);
+    BOOST_CHECK(meshShape->vertArray != nullptr);
+    BOOST_CHECK_EQUAL(cache.size(), 2);
+
+    // Shapes in use outlive the cache entries
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.size(), 0);
+    BOOST_CHECK_EQUAL(boxShape->children.size(), 2);
+    BOOST_CHECK(cache.getShape(&box) != boxShape);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -47,6 +47,7 @@ simpleConfig_t getValidConfig() {
     result["input"]["invert_y"] =
         "1 #values != 0 enable input inversion. Optional.";
     result["game"]["hud_scale"] = "2.0\t;HUD scale";
+    result["game"]["asset_cache"] = "/dev/cache";
     return result;
 }
 
@@ -296,6 +297,7 @@ BOOST_AUTO_TEST_CASE(test_config_valid) {
     BOOST_CHECK_EQUAL(config.getGameLanguage(), "american");
     BOOST_CHECK(config.getInputInvertY());
     BOOST_CHECK_EQUAL(config.getHUDScale(), 2.f);
+    BOOST_CHECK_EQUAL(config.getAssetCachePath().string(), "/dev/cache");
 }
 
 BOOST_AUTO_TEST_CASE(test_config_valid_modified) {
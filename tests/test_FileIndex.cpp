@@ -63,12 +63,25 @@ BOOST_AUTO_TEST_CASE(test_indexArchive) {
         BOOST_CHECK(handle.data == nullptr);
     }
 
-    index.indexArchive("models/gta3.img");
+    auto archive = index.indexArchive("models/gta3.img");
+    BOOST_CHECK(archive != nullptr);
 
     {
         auto handle = index.openFile("landstal.dff");
         BOOST_CHECK(handle.data != nullptr);
+        BOOST_CHECK(handle.isMapped());
     }
+
+    {
+        // Repeated opens share the same mapping
+        auto a = index.openFile("landstal.dff");
+        auto b = index.openFile("landstal.dff");
+        BOOST_CHECK_EQUAL(static_cast<void*>(a.data),
+                          static_cast<void*>(b.data));
+    }
+
+    // The archive is only loaded once
+    BOOST_CHECK_EQUAL(index.indexArchive("MODELS/GTA3.IMG"), archive);
 }
 #endif
 
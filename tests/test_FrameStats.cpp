@@ -0,0 +1,51 @@
+#include <boost/test/unit_test.hpp>
+#include <FrameStats.hpp>
+
+BOOST_AUTO_TEST_SUITE(FrameStatsTests)
+
+BOOST_AUTO_TEST_CASE(test_empty_summary) {
+    FrameTimeRecorder recorder(16);
+    auto summary = recorder.summarize();
+    BOOST_CHECK_EQUAL(summary.frames, 0);
+    BOOST_CHECK_EQUAL(summary.max, 0.f);
+}
+
+BOOST_AUTO_TEST_CASE(test_percentiles) {
+    FrameTimeRecorder recorder(128);
+    // 1ms to 100ms, in reverse so the order doesn't match the ranks
+    for (int i = 100; i >= 1; --i) {
+        recorder.record(i / 1000.f);
+    }
+
+    auto summary = recorder.summarize();
+    BOOST_CHECK_EQUAL(summary.frames, 100);
+    BOOST_CHECK_CLOSE(summary.mean, 0.0505f, 0.01f);
+    BOOST_CHECK_CLOSE(summary.p50, 0.050f, 0.01f);
+    BOOST_CHECK_CLOSE(summary.p90, 0.090f, 0.01f);
+    BOOST_CHECK_CLOSE(summary.p99, 0.099f, 0.01f);
+    BOOST_CHECK_CLOSE(summary.max, 0.100f, 0.01f);
+    // 34ms and up
+    BOOST_CHECK_EQUAL(summary.hitches, 67);
+}
+
+BOOST_AUTO_TEST_CASE(test_ring_keeps_latest_frames) {
+    FrameTimeRecorder recorder(4);
+    for (int i = 0; i < 4; ++i) {
+        recorder.record(1.f);
+    }
+    for (int i = 0; i < 4; ++i) {
+        recorder.record(0.01f);
+    }
+
+    BOOST_CHECK_EQUAL(recorder.size(), 4);
+    BOOST_CHECK_EQUAL(recorder.getRecordedCount(), 8);
+    auto summary = recorder.summarize();
+    BOOST_CHECK_EQUAL(summary.frames, 4);
+    BOOST_CHECK_CLOSE(summary.max, 0.01f, 0.01f);
+    BOOST_CHECK_EQUAL(summary.hitches, 0);
+
+    recorder.clear();
+    BOOST_CHECK_EQUAL(recorder.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,5 +1,9 @@
 #include <boost/test/unit_test.hpp>
 #include <engine/GameData.hpp>
+
+#include <chrono>
+#include <thread>
+
 #include "test_Globals.hpp"
 
 BOOST_AUTO_TEST_SUITE(GameDataTests)
@@ -9,7 +13,7 @@ BOOST_AUTO_TEST_CASE(test_object_data) {
     GameData gd(&Global::get().log, Global::getGamePath());
     gd.load();
 
-    GameWorld gw(&Global::get().log, &gd);
+    GameWorld gw(&Global::get().log, &gd, &Global::get().jobs);
     {
         auto def = gd.findModelInfo<SimpleModelInfo>(1100);
 
@@ -94,6 +98,27 @@ BOOST_AUTO_TEST_CASE(test_ped_groups) {
     BOOST_REQUIRE_GE(red.size(), 8);
     BOOST_CHECK_EQUAL(red[0], 34);
 }
+
+BOOST_AUTO_TEST_CASE(test_request_model) {
+    GameData gd(&Global::get().log, Global::getGamePath());
+    gd.load();
+
+    auto def = gd.findModelInfo<SimpleModelInfo>(1100);
+    BOOST_REQUIRE(def);
+    BOOST_REQUIRE(!def->isLoaded());
+
+    gd.requestModel(1100);
+    // Requesting again while the model is being read is harmless
+    gd.requestModel(1100, 10);
+
+    for (int i = 0; i < 1000 && !def->isLoaded(); ++i) {
+        gd.updateStreaming();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    BOOST_CHECK(def->isLoaded());
+    BOOST_CHECK_NE(def->getAtomic(0), nullptr);
+}
 #endif
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,9 +1,15 @@
 #include <boost/test/unit_test.hpp>
 #include <engine/GameData.hpp>
+#include <dynamics/CollisionInstance.hpp>
 #include <engine/GameWorld.hpp>
+#include <objects/CharacterObject.hpp>
 #include <objects/InstanceObject.hpp>
+#include <objects/VehicleObject.hpp>
 #include "test_Globals.hpp"
 
+#include <algorithm>
+#include <vector>
+
 BOOST_AUTO_TEST_SUITE(GameWorldTests)
 
 #if RW_TEST_WITH_DATA
@@ -67,6 +73,166 @@ BOOST_AUTO_TEST_CASE(test_offsetgametime) {
     BOOST_CHECK_EQUAL(9, gw.getHour());
     BOOST_CHECK_EQUAL(25, gw.getMinute());
 }
+
+BOOST_AUTO_TEST_CASE(test_uprooted_instance_physics) {
+    auto& gw = *Global::get().e;
+
+    // Find a prop that is fixed until it is knocked loose
+    InstanceObject* object = nullptr;
+    for (const auto& dynamic : gw.data->dynamicObjectData) {
+        const auto& dynamics = *dynamic.second;
+        if (dynamics.uprootForce <= 0.f || dynamics.collDamageEffect != 0 ||
+            dynamics.collResponseFlags == 0) {
+            continue;
+        }
+        auto id = gw.data->findModelObject(dynamics.modelName);
+        object = gw.createInstance(id, glm::vec3(100.f, 0.f, 0.f));
+        if (object && object->body && !object->isStatic() &&
+            !object->isFloating()) {
+            break;
+        }
+        if (object) {
+            gw.destroyObject(object);
+            object = nullptr;
+        }
+    }
+    BOOST_REQUIRE(object != nullptr);
+    BOOST_CHECK(object->getPhysicsState() ==
+                InstanceObject::PhysicsState::Fixed);
+    BOOST_CHECK(!object->isAwake());
+    BOOST_CHECK_EQUAL(object->body->getMass(), 0.f);
+
+    GameObject::DamageInfo damage{};
+    damage.hitpoints = 1.f;
+    damage.impulse = object->dynamics->uprootForce;
+    object->takeDamage(damage);
+    BOOST_CHECK(object->getPhysicsState() ==
+                InstanceObject::PhysicsState::Uprooted);
+    BOOST_CHECK(object->isAwake());
+
+    // The mass is applied once, after which the object has nothing to tick
+    object->tickPhysics(0.016f);
+    BOOST_CHECK(object->getPhysicsState() ==
+                InstanceObject::PhysicsState::Dynamic);
+    BOOST_CHECK_EQUAL(object->body->getMass(), object->dynamics->mass);
+    BOOST_CHECK(!object->needsPhysicsTick());
+
+    gw.destroyObject(object);
+}
+
+BOOST_AUTO_TEST_CASE(test_area_queries) {
+    auto& gw = *Global::get().e;
+    const glm::vec3 center{-1800.f, -1800.f, 0.f};
+
+    auto character = gw.createPedestrian(1, center + glm::vec3(2.f, 0.f, 0.f));
+    auto vehicle = gw.createVehicle(90u, center + glm::vec3(0.f, 8.f, 0.f),
+                                    glm::quat{1.0f, 0.0f, 0.0f, 0.0f});
+    auto instance = gw.createInstance(1337, center + glm::vec3(-3.f, 0.f, 0.f));
+    BOOST_REQUIRE(character != nullptr);
+    BOOST_REQUIRE(vehicle != nullptr);
+    BOOST_REQUIRE(instance != nullptr);
+
+    const auto found = [](const std::vector<GameObject*>& objects,
+                          GameObject* object) {
+        return std::find(objects.begin(), objects.end(), object) !=
+               objects.end();
+    };
+    const auto all = GameObject::typeMask(GameObject::Character) |
+                     GameObject::typeMask(GameObject::Vehicle) |
+                     GameObject::typeMask(GameObject::Instance);
+
+    std::vector<GameObject*> objects;
+    gw.findObjectsInSphere(center, 5.f, all, objects);
+    BOOST_CHECK(found(objects, character));
+    BOOST_CHECK(!found(objects, vehicle));
+    // Instances are found through their collision
+    BOOST_CHECK_EQUAL(found(objects, instance), instance->body != nullptr);
+
+    objects.clear();
+    gw.findObjectsInSphere(center, 10.f,
+                           GameObject::typeMask(GameObject::Vehicle), objects);
+    BOOST_CHECK(found(objects, vehicle));
+    BOOST_CHECK(!found(objects, character));
+
+    objects.clear();
+    gw.findObjectsInBox(center + glm::vec3(-1.f, -1.f, -1.f),
+                        center + glm::vec3(10.f, 10.f, 1.f), all, objects);
+    BOOST_CHECK(found(objects, character));
+    BOOST_CHECK(found(objects, vehicle));
+    BOOST_CHECK(!found(objects, instance));
+
+    gw.destroyObject(character);
+    gw.destroyObject(vehicle);
+    gw.destroyObject(instance);
+
+    objects.clear();
+    gw.findObjectsInSphere(center, 10.f, all, objects);
+    BOOST_CHECK(objects.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_ground_queries) {
+    auto& gw = *Global::get().e;
+    const glm::vec3 position{-1700.f, -1700.f, 0.f};
+
+    BOOST_CHECK(gw.getGroundAtPosition(position) == position);
+
+    // Find a model with collision that stays in place
+    InstanceObject* object = nullptr;
+    for (const auto& info : gw.data->modelinfo) {
+        if (info.second->type() != ModelDataType::SimpleInfo ||
+            !info.second->getCollision()) {
+            continue;
+        }
+        object = gw.createInstance(info.first, position);
+        if (object && object->body && object->body->getMass() == 0.f) {
+            break;
+        }
+        if (object) {
+            gw.destroyObject(object);
+            object = nullptr;
+        }
+    }
+    BOOST_REQUIRE(object != nullptr);
+
+    // The batch finds the same hits as testing the whole world
+    std::vector<RayQuery> rays;
+    for (float x = -5.f; x <= 5.f; x += 1.f) {
+        for (float y = -5.f; y <= 5.f; y += 1.f) {
+            RayQuery ray;
+            ray.from = position + glm::vec3(x, y, 100.f);
+            ray.to = position + glm::vec3(x, y, -100.f);
+            rays.push_back(ray);
+        }
+    }
+    gw.rayTestStatic(rays);
+
+    const RayQuery* hit = nullptr;
+    for (const auto& ray : rays) {
+        btVector3 from(ray.from.x, ray.from.y, ray.from.z);
+        btVector3 to(ray.to.x, ray.to.y, ray.to.z);
+        btCollisionWorld::ClosestRayResultCallback expected(from, to);
+        gw.dynamicsWorld->rayTest(from, to, expected);
+
+        BOOST_REQUIRE_EQUAL(ray.hit, expected.hasHit());
+        if (ray.hit) {
+            BOOST_CHECK_EQUAL(ray.object, object);
+            BOOST_CHECK_CLOSE(ray.hitPosition.z,
+                              expected.m_hitPointWorld.z(), 0.01f);
+            hit = &ray;
+        }
+    }
+    BOOST_REQUIRE(hit != nullptr);
+
+    // Probes are cached until the collision changes
+    const glm::vec3 ground(hit->from.x, hit->from.y, 0.f);
+    BOOST_CHECK_CLOSE(gw.getGroundAtPosition(ground).z, hit->hitPosition.z,
+                      0.01f);
+    BOOST_CHECK_CLOSE(gw.getGroundAtPosition(ground).z, hit->hitPosition.z,
+                      0.01f);
+
+    gw.destroyObject(object);
+    BOOST_CHECK(gw.getGroundAtPosition(ground) == ground);
+}
 #endif
 
 BOOST_AUTO_TEST_SUITE_END()
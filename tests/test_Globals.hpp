@@ -12,6 +12,7 @@
 #include <SDL.h>
 #include <GameWindow.hpp>
 #include <boost/test/unit_test.hpp>
+#include <core/JobSystem.hpp>
 #include <core/Logger.hpp>
 #include <engine/GameData.hpp>
 #include <engine/GameState.hpp>
@@ -85,6 +86,7 @@ public:
     GameWorld* e;
     GameState* s;
     Logger log;
+    JobSystem jobs;
 #endif
 
     Global() {
@@ -99,7 +101,7 @@ public:
 
         d->load();
 
-        e = new GameWorld(&log, d);
+        e = new GameWorld(&log, d, &jobs);
         s = new GameState;
         e->state = s;
 
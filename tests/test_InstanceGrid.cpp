@@ -0,0 +1,75 @@
+#include <boost/test/unit_test.hpp>
+#include <glm/gtc/constants.hpp>
+#include <engine/GameWorld.hpp>
+#include <engine/InstanceGrid.hpp>
+#include <objects/InstanceObject.hpp>
+#include <render/ViewCamera.hpp>
+#include "test_Globals.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+ViewCamera createCamera(const glm::vec3& position,
+                        const glm::quat& rotation = {1.f, 0.f, 0.f, 0.f}) {
+    ViewCamera camera(position, rotation);
+    camera.frustum.update(camera.frustum.projection() * camera.getView());
+    return camera;
+}
+
+bool contains(const std::vector<GameObject*>& objects, GameObject* object) {
+    return std::find(objects.begin(), objects.end(), object) != objects.end();
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(InstanceGridTests)
+
+BOOST_AUTO_TEST_CASE(test_cell_index) {
+    const auto origin = InstanceGrid::getCellIndex({0.f, 0.f, 0.f});
+    BOOST_CHECK_EQUAL(origin, InstanceGrid::getCellIndex({50.f, 50.f, 100.f}));
+    BOOST_CHECK_NE(origin, InstanceGrid::getCellIndex({-50.f, 0.f, 0.f}));
+    const auto cellSize = static_cast<float>(WORLD_CELL_SIZE);
+    BOOST_CHECK_EQUAL(InstanceGrid::getCellIndex({0.f, cellSize, 0.f}),
+                      origin + 1);
+
+    // Positions outside of the world use the edge cells
+    BOOST_CHECK_EQUAL(InstanceGrid::getCellIndex({-1e6f, -1e6f, 0.f}), 0);
+    BOOST_CHECK_EQUAL(InstanceGrid::getCellIndex({1e6f, 1e6f, 0.f}),
+                      static_cast<size_t>(WORLD_GRID_CELLS - 1));
+}
+
+#if RW_TEST_WITH_DATA
+BOOST_AUTO_TEST_CASE(test_visible_instances) {
+    auto& gw = *Global::get().e;
+    const glm::vec3 position{-1850.f, -1850.f, 0.f};
+    auto instance = gw.createInstance(1337, position);
+    BOOST_REQUIRE(instance != nullptr);
+
+    std::vector<GameObject*> visible;
+    gw.instanceGrid.findVisible(
+        createCamera(position - glm::vec3(10.f, 0.f, 0.f)), 1.f, visible);
+    BOOST_CHECK(contains(visible, instance));
+
+    // Behind the camera
+    visible.clear();
+    gw.instanceGrid.findVisible(
+        createCamera(position - glm::vec3(200.f, 0.f, 0.f),
+                     glm::angleAxis(glm::pi<float>(), glm::vec3(0.f, 0.f, 1.f))),
+        1.f, visible);
+    BOOST_CHECK(!contains(visible, instance));
+
+    // Too far away
+    visible.clear();
+    gw.instanceGrid.findVisible(
+        createCamera(position - glm::vec3(3000.f, 0.f, 0.f)), 1.f, visible);
+    BOOST_CHECK(!contains(visible, instance));
+
+    gw.destroyObject(instance);
+    visible.clear();
+    gw.instanceGrid.findVisible(
+        createCamera(position - glm::vec3(10.f, 0.f, 0.f)), 1.f, visible);
+    BOOST_CHECK(!contains(visible, instance));
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,47 @@
+#include <boost/test/unit_test.hpp>
+#include <core/JobSystem.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(JobSystemTests)
+
+BOOST_AUTO_TEST_CASE(test_parallel_for_runs_each_index_once) {
+    JobSystem jobs(3);
+    BOOST_CHECK_EQUAL(jobs.getThreadCount(), 4);
+
+    std::vector<std::atomic<int>> calls(1000);
+    jobs.parallelFor(calls.size(), [&](size_t i) { calls[i]++; });
+
+    for (const auto& count : calls) {
+        BOOST_CHECK_EQUAL(count.load(), 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_for_repeated_batches) {
+    JobSystem jobs(2);
+
+    std::vector<size_t> results(64);
+    for (size_t batch = 1; batch <= 50; ++batch) {
+        jobs.parallelFor(results.size(),
+                         [&](size_t i) { results[i] = i * batch; });
+        for (size_t i = 0; i < results.size(); ++i) {
+            BOOST_REQUIRE_EQUAL(results[i], i * batch);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_for_without_workers) {
+    JobSystem jobs(0);
+    BOOST_CHECK_EQUAL(jobs.getThreadCount(), 1);
+
+    std::vector<size_t> order;
+    jobs.parallelFor(4, [&](size_t i) { order.push_back(i); });
+    BOOST_CHECK(order == (std::vector<size_t>{0, 1, 2, 3}));
+
+    jobs.parallelFor(0, [&](size_t) { order.clear(); });
+    BOOST_CHECK_EQUAL(order.size(), 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -68,4 +68,35 @@ BOOST_AUTO_TEST_CASE(test_clump_clone) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_frame_world_transform) {
+    auto root = std::make_shared<ModelFrame>(0);
+    auto child = std::make_shared<ModelFrame>(1);
+    auto leaf = std::make_shared<ModelFrame>(2);
+    root->addChild(child);
+    child->addChild(leaf);
+
+    leaf->setTranslation({0.f, 0.f, 1.f});
+    BOOST_CHECK_EQUAL(leaf->getWorldTransform()[3].z, 1.f);
+
+    // Changes to an ancestor reach frames that were already up to date
+    root->setTranslation({1.f, 0.f, 0.f});
+    child->setTranslation({0.f, 2.f, 0.f});
+    BOOST_CHECK_EQUAL(leaf->getWorldTransform()[3].x, 1.f);
+    BOOST_CHECK_EQUAL(leaf->getWorldTransform()[3].y, 2.f);
+    BOOST_CHECK_EQUAL(leaf->getWorldTransform()[3].z, 1.f);
+
+    root->setTranslation({3.f, 0.f, 0.f});
+    root->updateHierarchyTransform();
+    BOOST_CHECK_EQUAL(child->getWorldTransform()[3].x, 3.f);
+    BOOST_CHECK_EQUAL(leaf->getWorldTransform()[3].x, 3.f);
+
+    // Moving a frame to another parent moves it into that parent's space
+    auto other = std::make_shared<ModelFrame>(3);
+    other->setTranslation({0.f, 0.f, 5.f});
+    other->addChild(leaf);
+    BOOST_CHECK_EQUAL(leaf->getWorldTransform()[3].x, 0.f);
+    BOOST_CHECK_EQUAL(leaf->getWorldTransform()[3].z, 6.f);
+    BOOST_CHECK(child->getChildren().empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
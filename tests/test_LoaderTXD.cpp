@@ -0,0 +1,146 @@
+#include <boost/test/unit_test.hpp>
+#include <loaders/LoaderTXD.hpp>
+#include <loaders/RWBinaryStream.hpp>
+#include <platform/FileHandle.hpp>
+#include "test_Globals.hpp"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+constexpr uint16_t kWidth = 5;
+constexpr uint16_t kHeight = 3;
+constexpr size_t kPaletteSize = 256;
+
+uint32_t paletteColor(size_t i) {
+    return static_cast<uint32_t>(i * 0x01010101u) ^ 0xFF00FF00u;
+}
+
+uint8_t paletteIndex(size_t pixel) {
+    return static_cast<uint8_t>((pixel * 37) % kPaletteSize);
+}
+
+/// Builds a TXD containing a single PAL8 texture
+FileContentsInfo createPal8TXD(uint32_t platform) {
+    const size_t pixels = kWidth * kHeight;
+    const size_t header = sizeof(RW::BSSectionHeader);
+    // The palette overlaps the last field of the native structure
+    const size_t nativeData = sizeof(RW::BSTextureNative) - sizeof(uint32_t) +
+                              kPaletteSize * sizeof(uint32_t) +
+                              sizeof(uint32_t) + pixels;
+    const size_t nativeSection = header + nativeData;
+    const size_t rootData =
+        header + sizeof(RW::BSTextureDictionary) + header + nativeSection;
+    const size_t length = header + rootData;
+
+    auto data = std::make_unique<char[]>(length);
+    std::memset(data.get(), 0, length);
+    char* cursor = data.get();
+
+    auto writeHeader = [&](uint32_t id, size_t size) {
+        RW::BSSectionHeader section{id, static_cast<uint32_t>(size), 0};
+        std::memcpy(cursor, &section, sizeof(section));
+        cursor += sizeof(section);
+    };
+
+    writeHeader(RW::SID_TextureDictionary, rootData);
+    writeHeader(RW::SID_Struct, sizeof(RW::BSTextureDictionary));
+    RW::BSTextureDictionary dictionary{1, 0};
+    std::memcpy(cursor, &dictionary, sizeof(dictionary));
+    cursor += sizeof(dictionary);
+
+    writeHeader(RW::SID_TextureNative, nativeSection);
+    writeHeader(RW::SID_Struct, nativeData);
+    RW::BSTextureNative native{};
+    native.platform = platform;
+    native.filterflags = RW::BSTextureNative::FILTER_NEAREST;
+    native.wrapU = RW::BSTextureNative::WRAP_CLAMP;
+    native.wrapV = RW::BSTextureNative::WRAP_MIRROR;
+    std::strcpy(native.diffuseName, "TestTex");
+    native.rasterformat = RW::BSTextureNative::FORMAT_EXT_PAL8 |
+                          RW::BSTextureNative::FORMAT_8888;
+    native.width = kWidth;
+    native.height = kHeight;
+    native.bpp = 8;
+    std::memcpy(cursor, &native, sizeof(native));
+    cursor += sizeof(native) - sizeof(uint32_t);
+
+    for (size_t i = 0; i < kPaletteSize; ++i) {
+        const uint32_t color = paletteColor(i);
+        std::memcpy(cursor, &color, sizeof(color));
+        cursor += sizeof(color);
+    }
+    const auto rasterSize = static_cast<uint32_t>(pixels);
+    std::memcpy(cursor, &rasterSize, sizeof(rasterSize));
+    cursor += sizeof(rasterSize);
+    for (size_t i = 0; i < pixels; ++i) {
+        *cursor++ = static_cast<char>(paletteIndex(i));
+    }
+
+    return FileContentsInfo(std::move(data), length);
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(LoaderTXDTests)
+
+BOOST_AUTO_TEST_CASE(test_decode_pal8) {
+    auto file = createPal8TXD(8);
+
+    TextureLoader loader;
+    std::vector<DecodedTexture> textures;
+    BOOST_REQUIRE(loader.decodeFromMemory(file, textures));
+    BOOST_REQUIRE_EQUAL(textures.size(), 1);
+
+    const auto& texture = textures[0];
+    BOOST_CHECK_EQUAL(texture.name, "testtex");
+    BOOST_REQUIRE(texture.isValid());
+    BOOST_CHECK(texture.format == DecodedTexture::Format::RGBA8);
+    BOOST_CHECK(texture.filter == DecodedTexture::Filter::Nearest);
+    BOOST_CHECK(texture.wrapU == DecodedTexture::Wrap::Clamp);
+    BOOST_CHECK(texture.wrapV == DecodedTexture::Wrap::Mirror);
+    BOOST_CHECK(texture.transparent);
+
+    BOOST_REQUIRE_EQUAL(texture.levels.size(), 1);
+    const auto& level = texture.levels[0];
+    BOOST_CHECK_EQUAL(level.width, kWidth);
+    BOOST_CHECK_EQUAL(level.height, kHeight);
+    BOOST_REQUIRE_EQUAL(level.pixels.size(),
+                        kWidth * kHeight * sizeof(uint32_t));
+
+    for (size_t i = 0; i < kWidth * kHeight; ++i) {
+        uint32_t color;
+        std::memcpy(&color, level.pixels.data() + i * sizeof(uint32_t),
+                    sizeof(color));
+        BOOST_CHECK_EQUAL(color, paletteColor(paletteIndex(i)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_decode_unsupported_platform) {
+    auto file = createPal8TXD(9);
+
+    TextureLoader loader;
+    std::vector<DecodedTexture> textures;
+    BOOST_REQUIRE(loader.decodeFromMemory(file, textures));
+    BOOST_REQUIRE_EQUAL(textures.size(), 1);
+    BOOST_CHECK_EQUAL(textures[0].name, "testtex");
+    BOOST_CHECK(!textures[0].isValid());
+}
+
+#if RW_TEST_WITH_DATA
+BOOST_AUTO_TEST_CASE(test_decode_archive) {
+    auto file = Global::get().e->data->index.openFile("particle.txd");
+    BOOST_REQUIRE(file.data != nullptr);
+
+    TextureLoader loader;
+    std::vector<DecodedTexture> textures;
+    BOOST_REQUIRE(loader.decodeFromMemory(file, textures));
+    BOOST_REQUIRE(!textures.empty());
+
+    for (const auto& texture : textures) {
+        BOOST_CHECK(texture.isValid());
+    }
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
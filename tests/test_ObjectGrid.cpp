@@ -0,0 +1,81 @@
+#include <boost/test/unit_test.hpp>
+#include <engine/GameWorld.hpp>
+#include <engine/ObjectGrid.hpp>
+#include <objects/CharacterObject.hpp>
+#include "test_Globals.hpp"
+
+#include <algorithm>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(ObjectGridTests)
+
+BOOST_AUTO_TEST_CASE(test_within) {
+    // The grid never looks at the objects, only the positions given to it
+    ObjectGrid grid(10.f);
+    grid.insert(nullptr, {5.f, 5.f, 0.f});
+    grid.insert(nullptr, {-5.f, 5.f, 0.f});
+    grid.insert(nullptr, {100.f, 100.f, 0.f});
+    grid.build();
+    BOOST_CHECK_EQUAL(grid.size(), 3);
+
+    BOOST_CHECK(grid.isAnyWithin({5.f, 5.f, 0.f}, 1.f));
+    BOOST_CHECK(grid.isAnyWithin({0.f, 5.f, 0.f}, 5.f));
+    BOOST_CHECK(!grid.isAnyWithin({0.f, 5.f, 0.f}, 4.9f));
+    BOOST_CHECK(!grid.isAnyWithin({5.f, 5.f, 20.f}, 10.f));
+    BOOST_CHECK(!grid.isAnyWithin({50.f, 50.f, 0.f}, 40.f));
+
+    std::vector<GameObject*> found;
+    grid.findWithin({0.f, 5.f, 0.f}, 6.f, found);
+    BOOST_CHECK_EQUAL(found.size(), 2);
+
+    // Large searches still find everything
+    found.clear();
+    grid.findWithin({0.f, 0.f, 0.f}, 1000.f, found);
+    BOOST_CHECK_EQUAL(found.size(), 3);
+
+    grid.clear();
+    BOOST_CHECK_EQUAL(grid.size(), 0);
+    BOOST_CHECK(!grid.isAnyWithin({5.f, 5.f, 0.f}, 1.f));
+}
+
+BOOST_AUTO_TEST_CASE(test_distant_cells) {
+    // Cells far apart can share storage, only the nearby objects are found
+    ObjectGrid grid(10.f);
+    for (int i = 0; i < 100; ++i) {
+        grid.insert(nullptr, {i * 1000.f + 5.f, i * -730.f + 5.f, 0.f});
+    }
+    grid.build();
+
+    for (int i = 0; i < 100; ++i) {
+        std::vector<GameObject*> found;
+        grid.findWithin({i * 1000.f, i * -730.f, 0.f}, 10.f, found);
+        BOOST_CHECK_EQUAL(found.size(), 1);
+    }
+}
+
+#if RW_TEST_WITH_DATA
+BOOST_AUTO_TEST_CASE(test_world_objects) {
+    auto& gw = *Global::get().e;
+    const glm::vec3 position{-1900.f, -1900.f, 0.f};
+
+    BOOST_CHECK(!gw.getDynamicObjectGrid().isAnyWithin(position, 5.f));
+
+    auto character = gw.createPedestrian(1, position);
+    BOOST_REQUIRE(character != nullptr);
+    std::vector<GameObject*> found;
+    gw.getDynamicObjectGrid().findWithin(position, 5.f, found);
+    BOOST_CHECK(std::find(found.begin(), found.end(), character) !=
+                found.end());
+
+    // Moving the character is seen without waiting for the next tick
+    const glm::vec3 moved = position + glm::vec3(50.f, 0.f, 0.f);
+    character->setPosition(moved);
+    BOOST_CHECK(!gw.getDynamicObjectGrid().isAnyWithin(position, 5.f));
+    BOOST_CHECK(gw.getDynamicObjectGrid().isAnyWithin(moved, 5.f));
+
+    gw.destroyObject(character);
+    BOOST_CHECK(!gw.getDynamicObjectGrid().isAnyWithin(position, 5.f));
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,101 @@
+#include <boost/test/unit_test.hpp>
+#include <engine/ObjectPool.hpp>
+#include <objects/GameObject.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace {
+class TestObject : public GameObject {
+public:
+    explicit TestObject(GameObjectID id = 0)
+        : GameObject(nullptr, {}, {}, nullptr) {
+        setGameObjectID(id);
+    }
+
+    void tick(float) override {
+    }
+};
+
+GameObject* insert(ObjectPool& pool, GameObjectID id = 0) {
+    auto object = std::make_unique<TestObject>(id);
+    auto ptr = object.get();
+    pool.insert(std::move(object));
+    return ptr;
+}
+
+bool contains(const ObjectPool& pool, GameObject* object) {
+    const auto& objects = pool.getObjects();
+    return std::find(objects.begin(), objects.end(), object) != objects.end();
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ObjectPoolTests)
+
+BOOST_AUTO_TEST_CASE(test_ids) {
+    ObjectPool pool;
+    auto a = insert(pool);
+    auto b = insert(pool);
+    BOOST_CHECK_EQUAL(a->getGameObjectID(), 1);
+    BOOST_CHECK_EQUAL(b->getGameObjectID(), 2);
+    BOOST_CHECK_EQUAL(pool.find(1), a);
+    BOOST_CHECK_EQUAL(pool.find(2), b);
+    BOOST_CHECK(pool.find(0) == nullptr);
+    BOOST_CHECK(pool.find(3) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(test_stale_id) {
+    ObjectPool pool;
+    auto a = insert(pool);
+    const auto id = a->getGameObjectID();
+    pool.remove(a);
+    BOOST_CHECK(pool.find(id) == nullptr);
+
+    // The slot is reused, but the old ID doesn't find the new object
+    auto b = insert(pool);
+    BOOST_CHECK_EQUAL(ObjectPool::getIndex(b->getGameObjectID()),
+                      ObjectPool::getIndex(id));
+    BOOST_CHECK_NE(b->getGameObjectID(), id);
+    BOOST_CHECK(pool.find(id) == nullptr);
+    BOOST_CHECK_EQUAL(pool.find(b->getGameObjectID()), b);
+}
+
+BOOST_AUTO_TEST_CASE(test_remove) {
+    ObjectPool pool;
+    auto a = insert(pool);
+    auto b = insert(pool);
+    auto c = insert(pool);
+    pool.remove(a);
+    BOOST_CHECK_EQUAL(pool.size(), 2);
+    BOOST_CHECK(contains(pool, b));
+    BOOST_CHECK(contains(pool, c));
+
+    // The object moved into the gap can still be removed
+    pool.remove(c);
+    BOOST_CHECK_EQUAL(pool.size(), 1);
+    BOOST_CHECK(contains(pool, b));
+    BOOST_CHECK_EQUAL(pool.find(b->getGameObjectID()), b);
+
+    pool.clear();
+    BOOST_CHECK(pool.empty());
+    BOOST_CHECK(pool.find(2) == nullptr);
+    BOOST_CHECK_EQUAL(ObjectPool::getIndex(insert(pool)->getGameObjectID()),
+                      1);
+}
+
+BOOST_AUTO_TEST_CASE(test_requested_id) {
+    ObjectPool pool;
+    auto a = insert(pool, 5);
+    BOOST_CHECK_EQUAL(a->getGameObjectID(), 5);
+    BOOST_CHECK_EQUAL(pool.find(5), a);
+
+    // The slots skipped over are used first
+    BOOST_CHECK_EQUAL(insert(pool)->getGameObjectID(), 1);
+
+    // IDs in use aren't given out twice
+    auto b = insert(pool, 5);
+    BOOST_CHECK_NE(b->getGameObjectID(), 5);
+    BOOST_CHECK_EQUAL(pool.find(5), a);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
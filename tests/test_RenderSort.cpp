@@ -0,0 +1,140 @@
+#include <boost/test/unit_test.hpp>
+#include <render/RenderSort.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+Renderer::DrawParameters createDrawParameters(BlendMode blend,
+                                              GLuint texture) {
+    Renderer::DrawParameters dp;
+    dp.blendMode = blend;
+    dp.textures = {{texture}};
+    return dp;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(RenderSortTests)
+
+BOOST_AUTO_TEST_CASE(test_radix_sort_matches_stable_sort) {
+    std::mt19937_64 random(1234);
+    std::vector<RenderSortEntry> entries;
+    for (uint32_t i = 0; i < 5000; ++i) {
+        // Few distinct keys, so there are plenty of equal keys to keep in order
+        entries.push_back({(random() % 64) << 40 | random() % 16, i});
+    }
+
+    auto expected = entries;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const auto& a, const auto& b) { return a.key < b.key; });
+
+    std::vector<RenderSortEntry> scratch;
+    radixSort(entries, scratch);
+
+    BOOST_REQUIRE_EQUAL(entries.size(), expected.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        BOOST_REQUIRE_EQUAL(entries[i].key, expected[i].key);
+        BOOST_REQUIRE_EQUAL(entries[i].index, expected[i].index);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_radix_sort_equal_keys) {
+    std::vector<RenderSortEntry> entries{{7, 0}, {7, 1}, {7, 2}};
+    std::vector<RenderSortEntry> scratch;
+    radixSort(entries, scratch);
+
+    for (uint32_t i = 0; i < entries.size(); ++i) {
+        BOOST_CHECK_EQUAL(entries[i].index, i);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_opaque_before_blended) {
+    const auto opaque = createDrawParameters(BlendMode::BLEND_NONE, 1);
+    const auto blended = createDrawParameters(BlendMode::BLEND_ALPHA, 1);
+
+    BOOST_CHECK_LT(createRenderKey(opaque, nullptr, 1.f),
+                   createRenderKey(blended, nullptr, 0.f));
+    BOOST_CHECK_LT(createRenderKey(opaque, nullptr, 0.f),
+                   createRenderKey(blended, nullptr, 1.f));
+}
+
+BOOST_AUTO_TEST_CASE(test_depth_order) {
+    const auto opaque = createDrawParameters(BlendMode::BLEND_NONE, 1);
+    const auto blended = createDrawParameters(BlendMode::BLEND_ALPHA, 1);
+
+    // Opaque front to back, blended back to front
+    BOOST_CHECK_LT(createRenderKey(opaque, nullptr, 0.25f),
+                   createRenderKey(opaque, nullptr, 0.5f));
+    BOOST_CHECK_GT(createRenderKey(blended, nullptr, 0.25f),
+                   createRenderKey(blended, nullptr, 0.5f));
+
+    // Out of range depths are clamped
+    BOOST_CHECK_EQUAL(createRenderKey(opaque, nullptr, -1.f),
+                      createRenderKey(opaque, nullptr, 0.f));
+    BOOST_CHECK_EQUAL(createRenderKey(opaque, nullptr, 2.f),
+                      createRenderKey(opaque, nullptr, 1.f));
+}
+
+BOOST_AUTO_TEST_CASE(test_opaque_grouped_by_texture) {
+    const auto first = createDrawParameters(BlendMode::BLEND_NONE, 1);
+    const auto second = createDrawParameters(BlendMode::BLEND_NONE, 2);
+
+    // Texture takes priority over depth
+    BOOST_CHECK_LT(createRenderKey(first, nullptr, 1.f),
+                   createRenderKey(second, nullptr, 0.f));
+
+    auto noDepthWrite = first;
+    noDepthWrite.depthWrite = false;
+    BOOST_CHECK_LT(createRenderKey(second, nullptr, 1.f),
+                   createRenderKey(noDepthWrite, nullptr, 0.f));
+}
+
+BOOST_AUTO_TEST_CASE(test_render_list_append) {
+    glm::mat4 first{1.f};
+    glm::mat4 second{2.f};
+
+    RenderList a;
+    a.add(1, first, nullptr, {});
+    RenderList b;
+    const auto shared = b.addTransform(second);
+    b.add(2, shared, nullptr, {});
+    b.add(3, shared, nullptr, {});
+
+    a.append(b);
+    BOOST_REQUIRE_EQUAL(a.size(), 3);
+    BOOST_CHECK_EQUAL(a.transforms.size(), 2);
+    BOOST_CHECK_EQUAL(a.transformIndices[1], 1);
+    BOOST_CHECK_EQUAL(a.transformIndices[2], 1);
+    BOOST_CHECK_EQUAL(a.getTransform(2)[0][0], 2.f);
+
+    a.clear();
+    BOOST_CHECK(a.empty());
+    BOOST_CHECK(a.transforms.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_render_list_sorter) {
+    RenderList list;
+    for (uint32_t i = 0; i < 4; ++i) {
+        auto dp = createDrawParameters(BlendMode::BLEND_NONE, i);
+        list.add(10 - i, glm::mat4{static_cast<float>(i)}, nullptr, dp);
+    }
+
+    RenderListSorter sorter;
+    sorter.sort(list);
+
+    BOOST_REQUIRE_EQUAL(list.size(), 4);
+    BOOST_CHECK_EQUAL(list.transforms.size(), 4);
+    for (uint32_t i = 0; i < 4; ++i) {
+        // Draws move together with their key, transforms stay in place
+        const auto original = 3 - i;
+        BOOST_CHECK_EQUAL(list.keys[i], 10 - original);
+        BOOST_CHECK_EQUAL(list.states[i].drawInfo.textures[0], original);
+        BOOST_CHECK_EQUAL(list.transformIndices[i], original);
+        BOOST_CHECK_EQUAL(list.getTransform(i)[0][0],
+                          static_cast<float>(original));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
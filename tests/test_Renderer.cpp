@@ -1,6 +1,98 @@
 #include <boost/test/unit_test.hpp>
+#include <gl/DrawBuffer.hpp>
 #include <render/GameRenderer.hpp>
 
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+/// Records what drawBatched asks of the renderer instead of drawing
+class MockRenderer final : public Renderer {
+public:
+    struct Instances {
+        DrawBuffer* draw;
+        GLuint firstObject;
+        GLsizei instances;
+    };
+
+    std::vector<size_t> uploads;
+    std::vector<ObjectUniformData> objects;
+    std::vector<Instances> draws;
+
+    std::string getIDString() const override {
+        return "Mock";
+    }
+    std::unique_ptr<ShaderProgram> createShader(const std::string&,
+                                                const std::string&) override {
+        return nullptr;
+    }
+    void useProgram(ShaderProgram*) override {
+    }
+    void setProgramBlockBinding(ShaderProgram*, const std::string&,
+                                GLint) override {
+    }
+    void setUniformTexture(ShaderProgram*, const std::string&,
+                           GLint) override {
+    }
+    void setUniform(ShaderProgram*, const std::string&,
+                    const glm::mat4&) override {
+    }
+    void setUniform(ShaderProgram*, const std::string&,
+                    const glm::vec4&) override {
+    }
+    void setUniform(ShaderProgram*, const std::string&,
+                    const glm::vec3&) override {
+    }
+    void setUniform(ShaderProgram*, const std::string&,
+                    const glm::vec2&) override {
+    }
+    void setUniform(ShaderProgram*, const std::string&, float) override {
+    }
+    void clear(const glm::vec4&, bool, bool) override {
+    }
+    void setSceneParameters(const SceneUniformData&) override {
+    }
+    void draw(const glm::mat4&, DrawBuffer*, const DrawParameters&) override {
+    }
+    void drawArrays(const glm::mat4&, DrawBuffer*,
+                    const DrawParameters&) override {
+    }
+    void invalidate() override {
+    }
+    void pushDebugGroup(const std::string&) override {
+    }
+    const ProfileInfo& popDebugGroup() override {
+        return profile;
+    }
+
+protected:
+    GLuint uploadObjects(const ObjectUniformData* data,
+                         size_t count) override {
+        uploads.push_back(count);
+        const auto firstObject = static_cast<GLuint>(objects.size());
+        objects.insert(objects.end(), data, data + count);
+        return firstObject;
+    }
+
+    void drawInstances(DrawBuffer* draw, const DrawParameters&,
+                       GLuint firstObject, GLsizei instances) override {
+        draws.push_back({draw, firstObject, instances});
+    }
+
+private:
+    ProfileInfo profile;
+};
+
+Renderer::DrawParameters createDrawParameters(GLuint texture) {
+    Renderer::DrawParameters dp;
+    dp.count = 6;
+    dp.textures = {{texture}};
+    dp.colour = {255, 255, 255, 255};
+    return dp;
+}
+}  // namespace
+
 BOOST_AUTO_TEST_SUITE(RendererTests)
 
 BOOST_AUTO_TEST_CASE(frustum_test_visible) {
@@ -23,4 +115,81 @@ BOOST_AUTO_TEST_CASE(frustum_test_visible) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_batched_instances) {
+    MockRenderer renderer;
+    DrawBuffer first, second;
+    const auto dp = createDrawParameters(1);
+    auto otherTexture = createDrawParameters(2);
+
+    RenderList list;
+    list.add(0, glm::mat4{1.f}, &first, dp);
+    list.add(0, glm::mat4{1.f}, &first, dp);
+    list.add(0, glm::mat4{1.f}, &first, dp);
+    list.add(0, glm::mat4{1.f}, &second, dp);
+    list.add(0, glm::mat4{1.f}, &second, otherTexture);
+    list.add(0, glm::mat4{1.f}, &first, dp);
+
+    renderer.drawBatched(list);
+
+    BOOST_REQUIRE_EQUAL(renderer.uploads.size(), 1);
+    BOOST_CHECK_EQUAL(renderer.uploads[0], list.size());
+
+    BOOST_REQUIRE_EQUAL(renderer.draws.size(), 4);
+    BOOST_CHECK(renderer.draws[0].draw == &first);
+    BOOST_CHECK_EQUAL(renderer.draws[0].firstObject, 0);
+    BOOST_CHECK_EQUAL(renderer.draws[0].instances, 3);
+    BOOST_CHECK(renderer.draws[1].draw == &second);
+    BOOST_CHECK_EQUAL(renderer.draws[1].firstObject, 3);
+    BOOST_CHECK_EQUAL(renderer.draws[1].instances, 1);
+    BOOST_CHECK_EQUAL(renderer.draws[2].firstObject, 4);
+    BOOST_CHECK_EQUAL(renderer.draws[3].firstObject, 5);
+}
+
+BOOST_AUTO_TEST_CASE(test_batched_object_data) {
+    MockRenderer renderer;
+    DrawBuffer buffer;
+    auto dp = createDrawParameters(1);
+
+    RenderList list;
+    list.add(0, glm::mat4{1.f}, &buffer, dp);
+    dp.colour = {0, 0, 0, 255};
+    dp.visibility = 0.5f;
+    list.add(0, glm::mat4{2.f}, &buffer, dp);
+
+    renderer.drawBatched(list);
+
+    // Per object values don't split instances
+    BOOST_REQUIRE_EQUAL(renderer.draws.size(), 1);
+    BOOST_CHECK_EQUAL(renderer.draws[0].instances, 2);
+
+    BOOST_REQUIRE_EQUAL(renderer.objects.size(), 2);
+    BOOST_CHECK_EQUAL(renderer.objects[0].colour.r, 1.f);
+    BOOST_CHECK_EQUAL(renderer.objects[1].colour.r, 0.f);
+    BOOST_CHECK_EQUAL(renderer.objects[1].visibility, 0.5f);
+    BOOST_CHECK_EQUAL(renderer.objects[1].model[0][0], 2.f);
+}
+
+BOOST_AUTO_TEST_CASE(test_batched_upload_limit) {
+    MockRenderer renderer;
+    DrawBuffer buffer;
+    const auto dp = createDrawParameters(1);
+
+    RenderList list;
+    const auto draws = Renderer::kMaxBatchObjects * 2 + 1;
+    for (size_t i = 0; i < draws; ++i) {
+        list.add(0, glm::mat4{1.f}, &buffer, dp);
+    }
+
+    renderer.drawBatched(list);
+
+    // Instances can't span uploads
+    BOOST_REQUIRE_EQUAL(renderer.uploads.size(), 3);
+    BOOST_CHECK_EQUAL(renderer.uploads[0], Renderer::kMaxBatchObjects);
+    BOOST_CHECK_EQUAL(renderer.uploads[2], 1);
+    BOOST_REQUIRE_EQUAL(renderer.draws.size(), 3);
+    BOOST_CHECK_EQUAL(renderer.draws[1].firstObject,
+                      Renderer::kMaxBatchObjects);
+    BOOST_CHECK_EQUAL(renderer.draws[2].instances, 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
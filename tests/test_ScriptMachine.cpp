@@ -1,6 +1,12 @@
 #include <boost/test/unit_test.hpp>
+#include <engine/GameState.hpp>
 #include <script/SCMFile.hpp>
 #include <script/ScriptMachine.hpp>
+#include <script/ScriptModule.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
 
 SCMByte data[] = {0x02, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
                   0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -8,6 +14,114 @@ SCMByte data[] = {0x02, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
                   0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
                   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
+namespace {
+/**
+ * Writes a script file with four globals and no models or missions, the code
+ * follows the header
+ */
+class SCMWriter {
+public:
+    static constexpr uint32_t kGlobals = 8;
+    static constexpr uint32_t kCode = 56;
+
+    SCMWriter() {
+        jump(kGlobals + 16);
+        bytes.push_back(0);
+        bytes.resize(bytes.size() + 16, 0);
+        jump(36);
+        bytes.push_back(0);
+        value(uint32_t{0});
+        jump(kCode);
+        bytes.push_back(0);
+        value(uint32_t{0});
+        value(uint32_t{0});
+        value(uint32_t{0});
+    }
+
+    uint32_t address() const {
+        return static_cast<uint32_t>(bytes.size());
+    }
+
+    void opcode(uint16_t op) {
+        value(op);
+    }
+
+    void int32(int32_t v) {
+        bytes.push_back(TInt32);
+        value(v);
+    }
+
+    void int8(int8_t v) {
+        bytes.push_back(TInt8);
+        value(v);
+    }
+
+    void global(uint16_t index) {
+        bytes.push_back(TGlobal);
+        value(static_cast<uint16_t>(index * SCM_VARIABLE_SIZE));
+    }
+
+    void local(uint16_t index) {
+        bytes.push_back(TLocal);
+        value(index);
+    }
+
+    void jump(uint32_t target) {
+        opcode(0x0002);
+        int32(static_cast<int32_t>(target));
+    }
+
+    /// Rewrites the target of the jump ending at address
+    void patchJump(uint32_t address, uint32_t target) {
+        std::memcpy(&bytes[address - sizeof(target)], &target,
+                    sizeof(target));
+    }
+
+    template <class T>
+    void value(T v) {
+        const auto at = bytes.size();
+        bytes.resize(at + sizeof(v));
+        std::memcpy(&bytes[at], &v, sizeof(v));
+    }
+
+    std::vector<char> bytes;
+};
+
+/**
+ * Just enough opcodes to test control flow and variables
+ */
+ScriptModule createTestModule() {
+    ScriptModule module("test");
+    module.bind(0x0001, 1, +[](const ScriptArguments& args, const ScriptInt t) {
+        args.getThread()->wakeCounter = t > 0 ? t : -1;
+    });
+    module.bind(0x0002, 1, +[](const ScriptArguments& args, const ScriptInt a) {
+        args.getThread()->programCounter = static_cast<SCMAddress>(a);
+    });
+    module.bind(0x0004, 2,
+                +[](const ScriptArguments&, ScriptInt& v, const ScriptInt n) {
+                    v = n;
+                });
+    module.bind(0x0038, 2,
+                +[](const ScriptArguments&, ScriptInt& v, const ScriptInt n) {
+                    return v == n;
+                });
+    module.bind(0x004D, 1, +[](const ScriptArguments& args, const ScriptInt a) {
+        if (!args.getThread()->conditionResult) {
+            args.getThread()->programCounter = static_cast<SCMAddress>(a);
+        }
+    });
+    return module;
+}
+
+int32_t getGlobal(ScriptMachine& machine, size_t index) {
+    int32_t v;
+    std::memcpy(&v, machine.getGlobals() + index * SCM_VARIABLE_SIZE,
+                sizeof(v));
+    return v;
+}
+}  // namespace
+
 BOOST_AUTO_TEST_SUITE(ScriptMachineTests)
 
 BOOST_AUTO_TEST_CASE(scmfile_test) {
@@ -17,6 +131,92 @@ BOOST_AUTO_TEST_CASE(scmfile_test) {
     BOOST_CHECK_EQUAL(f.getModelSection(), 0x10);
     BOOST_CHECK_EQUAL(f.getMissionSection(), 0x20);
     BOOST_CHECK_EQUAL(f.getCodeSection(), 0x28);
+    BOOST_CHECK_EQUAL(f.getSize(), sizeof(data));
+}
+
+BOOST_AUTO_TEST_CASE(module_find_opcode) {
+    ScriptModule module("test");
+    module.bind(0x0001, 1, +[](const ScriptArguments&, const ScriptInt) {});
+    module.bind(0x0100, 2,
+                +[](const ScriptArguments&, const ScriptInt, const ScriptInt) {
+                });
+
+    ScriptFunctionMeta* found = nullptr;
+    BOOST_REQUIRE(module.findOpcode(0x0001, &found));
+    BOOST_CHECK_EQUAL(found->arguments, 1);
+    BOOST_REQUIRE(module.findOpcode(0x0100, &found));
+    BOOST_CHECK_EQUAL(found->arguments, 2);
+
+    BOOST_CHECK(!module.findOpcode(0x0000, &found));
+    BOOST_CHECK(!module.findOpcode(0x0050, &found));
+    BOOST_CHECK(!module.findOpcode(0x0101, &found));
+}
+
+BOOST_AUTO_TEST_CASE(execute_decoded) {
+    SCMWriter w;
+    // $0 = 1, @1 = 5
+    w.opcode(0x0004);
+    w.global(0);
+    w.int8(1);
+    w.opcode(0x0004);
+    w.local(1);
+    w.int8(5);
+    // if not $0 == 2 then $1 = 2, else jump to the failure branch
+    w.opcode(0x8038);
+    w.global(0);
+    w.int8(2);
+    w.opcode(0x004D);
+    w.int32(0);
+    const auto failJump = w.address();
+    w.opcode(0x0004);
+    w.global(1);
+    w.int8(2);
+    // Jump over bytes that aren't an instruction, which stops the decoding
+    // sweep, so the code after them is decoded when the thread gets there
+    w.jump(0);
+    const auto lazyJump = w.address();
+    w.opcode(0x7FFF);
+    w.patchJump(lazyJump, w.address());
+    // $2 = 3, $3 = @1
+    w.opcode(0x0004);
+    w.global(2);
+    w.int8(3);
+    w.opcode(0x0004);
+    w.global(3);
+    w.local(1);
+    const auto idle = w.address();
+    w.opcode(0x0001);
+    w.int32(0);
+    w.jump(idle);
+    w.patchJump(failJump, w.address());
+    w.opcode(0x0004);
+    w.global(1);
+    w.int8(-1);
+    w.jump(idle);
+
+    SCMFile file;
+    file.loadFile(w.bytes.data(), w.bytes.size());
+    BOOST_REQUIRE_EQUAL(file.getCodeSection(), SCMWriter::kCode);
+
+    auto module = createTestModule();
+    GameState state;
+    ScriptMachine machine(&state, file, &module);
+    machine.startThread(file.getCodeSection());
+    machine.execute(0.f);
+
+    BOOST_CHECK_EQUAL(getGlobal(machine, 0), 1);
+    BOOST_CHECK_EQUAL(getGlobal(machine, 1), 2);
+    BOOST_CHECK_EQUAL(getGlobal(machine, 2), 3);
+    BOOST_CHECK_EQUAL(getGlobal(machine, 3), 5);
+
+    // The thread is waiting, and runs the same decoded instructions again
+    BOOST_REQUIRE_EQUAL(machine.getThreads().size(), 1);
+    BOOST_CHECK_EQUAL(machine.getThreads().front().programCounter,
+                      idle + 7);
+    machine.execute(0.f);
+    BOOST_CHECK_EQUAL(machine.getThreads().front().programCounter,
+                      idle + 7);
+    BOOST_CHECK_EQUAL(getGlobal(machine, 1), 2);
 }
 
 BOOST_AUTO_TEST_SUITE_END()